@@ -0,0 +1,35 @@
+# intx: extended precision integer library.
+# Copyright 2022 Pawel Bylica.
+# Licensed under the Apache License, Version 2.0.
+
+set(CMAKE_SYSTEM_PROCESSOR riscv64)
+set(CMAKE_SYSTEM_NAME Linux)
+# The compilers can be overridden, e.g. -DCMAKE_CXX_COMPILER=riscv64-linux-gnu-g++-12.
+if(NOT CMAKE_C_COMPILER)
+    set(CMAKE_C_COMPILER riscv64-linux-gnu-gcc)
+endif()
+if(NOT CMAKE_CXX_COMPILER)
+    set(CMAKE_CXX_COMPILER riscv64-linux-gnu-g++)
+endif()
+
+# RV64GC with the bit manipulation extensions Zba and Zbb (rev8 for bswap, clz, ctz)
+# if the compiler supports them (GCC 12+), otherwise plain RV64GC.
+execute_process(
+    COMMAND ${CMAKE_CXX_COMPILER} -march=rv64gc_zba_zbb -E -x c++ -
+    INPUT_FILE /dev/null OUTPUT_QUIET ERROR_QUIET
+    RESULT_VARIABLE zba_zbb_unsupported
+)
+if(zba_zbb_unsupported)
+    set(CMAKE_C_FLAGS_INIT -march=rv64gc)
+    set(CMAKE_CXX_FLAGS_INIT -march=rv64gc)
+else()
+    set(CMAKE_C_FLAGS_INIT -march=rv64gc_zba_zbb)
+    set(CMAKE_CXX_FLAGS_INIT -march=rv64gc_zba_zbb)
+endif()
+
+set(CMAKE_FIND_ROOT_PATH /usr/riscv64-linux-gnu)
+SET(CMAKE_FIND_ROOT_PATH_MODE_PROGRAM NEVER)
+SET(CMAKE_FIND_ROOT_PATH_MODE_LIBRARY ONLY)
+SET(CMAKE_FIND_ROOT_PATH_MODE_INCLUDE ONLY)
+
+set(CMAKE_CROSSCOMPILING_EMULATOR qemu-riscv64-static;-cpu;rv64,zba=true,zbb=true;-L;${CMAKE_FIND_ROOT_PATH})
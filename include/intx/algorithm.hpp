@@ -0,0 +1,212 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+/// @file
+/// Search and reduction algorithms over contiguous arrays of uint<N> values.
+
+#pragma once
+
+#include <intx/intx.hpp>
+#include <utility>
+
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define INTX_HAS_AVX2 1
+#else
+    #define INTX_HAS_AVX2 0
+#endif
+
+namespace intx
+{
+namespace internal
+{
+/// Three-way comparison of two uint values.
+///
+/// Returns a negative value if x < y, zero if x == y and a positive value if x > y.
+///
+/// With AVX2 the words are compared 4 at a time starting from the most significant ones.
+/// Within a group the result is computed without branches: for disjoint "greater" and "less"
+/// word masks the one having the highest bit set decides, so their difference has the sign
+/// of the comparison result. The next group is only inspected when all words were equal.
+/// Without AVX2 words are compared one by one starting from the top word.
+template <unsigned N>
+inline int compare(const uint<N>& x, const uint<N>& y) noexcept
+{
+    constexpr auto num_words = uint<N>::num_words;
+
+#if INTX_HAS_AVX2
+    if constexpr (num_words % 4 == 0)
+    {
+        const auto sign_bit = _mm256_set1_epi64x(std::numeric_limits<int64_t>::min());
+        for (size_t i = num_words; i != 0; i -= 4)
+        {
+            // Flip the sign bits to get unsigned comparison from the signed one.
+            const auto a = _mm256_xor_si256(
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&x[i - 4])), sign_bit);
+            const auto b = _mm256_xor_si256(
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&y[i - 4])), sign_bit);
+            const auto gt = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(a, b)));
+            const auto lt = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(b, a)));
+            if (i == 4 || gt != lt)
+                return gt - lt;
+        }
+    }
+#endif
+
+    for (size_t i = num_words; i-- > 1;)
+    {
+        if (x[i] != y[i])
+            return x[i] < y[i] ? -1 : 1;
+    }
+    return int{x[0] > y[0]} - int{x[0] < y[0]};
+}
+
+/// The "less than" predicate used by the algorithms.
+///
+/// Uses the vectorized compare() if available, otherwise the operator< is better
+/// than the scalar three-way comparison.
+template <unsigned N>
+inline bool less(const uint<N>& x, const uint<N>& y) noexcept
+{
+#if INTX_HAS_AVX2
+    if constexpr (uint<N>::num_words % 4 == 0)
+        return compare(x, y) < 0;
+#endif
+    return x < y;
+}
+}  // namespace internal
+
+/// Returns the pointer to the first element in [first, last) not less than the value
+/// or last if there is no such element.
+template <unsigned N>
+inline const uint<N>* find_first_ge(
+    const uint<N>* first, const uint<N>* last, const uint<N>& value) noexcept
+{
+    // Check 4 elements per iteration to have a single (well predicted) loop exit branch.
+    for (; last - first >= 4; first += 4)
+    {
+        const auto found = unsigned{!internal::less(first[0], value)} |
+                           unsigned{!internal::less(first[1], value)} |
+                           unsigned{!internal::less(first[2], value)} |
+                           unsigned{!internal::less(first[3], value)};
+        if (found != 0)
+            break;
+    }
+
+    for (; first != last; ++first)
+    {
+        if (!internal::less(*first, value))
+            break;
+    }
+    return first;
+}
+
+/// Returns the number of elements in [first, last) not less than the value.
+template <unsigned N>
+inline size_t count_ge(const uint<N>* first, const uint<N>* last, const uint<N>& value) noexcept
+{
+    size_t count = 0;
+    for (; first != last; ++first)
+        count += size_t{!internal::less(*first, value)};
+    return count;
+}
+
+/// Returns the pointer to the first smallest element in [first, last)
+/// or last if the range is empty.
+template <unsigned N>
+inline const uint<N>* min_element(const uint<N>* first, const uint<N>* last) noexcept
+{
+    if (first == last)
+        return last;
+
+    auto min_it = first;
+    auto min_value = *first;  // Keep the current minimum in a local to avoid reloads.
+    for (++first; first != last; ++first)
+    {
+        if (internal::less(*first, min_value))
+        {
+            min_it = first;
+            min_value = *first;
+        }
+    }
+    return min_it;
+}
+
+/// Returns the pointer to the first largest element in [first, last)
+/// or last if the range is empty.
+template <unsigned N>
+inline const uint<N>* max_element(const uint<N>* first, const uint<N>* last) noexcept
+{
+    if (first == last)
+        return last;
+
+    auto max_it = first;
+    auto max_value = *first;  // Keep the current maximum in a local to avoid reloads.
+    for (++first; first != last; ++first)
+    {
+        if (internal::less(max_value, *first))
+        {
+            max_it = first;
+            max_value = *first;
+        }
+    }
+    return max_it;
+}
+
+namespace internal
+{
+/// The equal_range() with the binary search done while the range is longer than the threshold.
+template <ptrdiff_t LinearScanThreshold, unsigned N>
+inline std::pair<const uint<N>*, const uint<N>*> equal_range(
+    const uint<N>* first, const uint<N>* last, const uint<N>& value) noexcept
+{
+    // Find the lower bound: the first element not less than the value.
+    auto lo = first;
+    auto len = last - first;
+    while (len > LinearScanThreshold)
+    {
+        const auto half = len / 2;
+        if (internal::less(lo[half], value))
+        {
+            lo += half + 1;
+            len -= half + 1;
+        }
+        else
+            len = half;
+    }
+    lo = find_first_ge(lo, lo + len, value);
+
+    // Find the upper bound: the first element greater than the value.
+    auto hi = lo;
+    len = last - lo;
+    while (len > LinearScanThreshold)
+    {
+        const auto half = len / 2;
+        if (!internal::less(value, hi[half]))
+        {
+            hi += half + 1;
+            len -= half + 1;
+        }
+        else
+            len = half;
+    }
+    for (const auto end = hi + len; hi != end && !internal::less(value, *hi); ++hi)
+        ;
+
+    return {lo, hi};
+}
+}  // namespace internal
+
+/// Returns the range of elements equal to the value in the sorted range [first, last).
+///
+/// The bounds are found by binary search until the remaining range is short,
+/// then the scan continues linearly what avoids mispredicted branches on the last steps.
+/// The length of the short range is INTX_EQUAL_RANGE_LINEAR_THRESHOLD.
+template <unsigned N>
+inline std::pair<const uint<N>*, const uint<N>*> equal_range(
+    const uint<N>* first, const uint<N>* last, const uint<N>& value) noexcept
+{
+    return internal::equal_range<INTX_EQUAL_RANGE_LINEAR_THRESHOLD>(first, last, value);
+}
+}  // namespace intx
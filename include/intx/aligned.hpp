@@ -0,0 +1,86 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+/// @file
+/// Over-aligned uint types and the aligned allocator for containers of them.
+
+#pragma once
+
+#include <intx/intx.hpp>
+#include <new>
+
+namespace intx
+{
+/// The uint<N> with the increased alignment.
+///
+/// The default alignment of 32 bytes matches the size of uint256 and the AVX2 vector width,
+/// so arrays of them never cross cache line boundaries. Use 64 to align to cache lines.
+/// The type is derived from uint<N> so it can be used anywhere uint<N> is expected and
+/// the results of uint<N> operators can be assigned to it.
+template <unsigned N, size_t Alignment = 32>
+struct alignas(Alignment) aligned_uint : uint<N>
+{
+    static_assert((Alignment & (Alignment - 1)) == 0, "alignment must be a power of 2");
+    static_assert(Alignment >= alignof(uint<N>), "alignment must not be decreased");
+
+    using uint<N>::uint;
+
+    constexpr aligned_uint() noexcept = default;
+
+    constexpr aligned_uint(const uint<N>& x) noexcept : uint<N>{x} {}  // NOLINT
+};
+
+using aligned_uint256 = aligned_uint<256>;
+using aligned_uint512 = aligned_uint<512, 64>;
+
+
+/// The allocator providing memory aligned to at least the Alignment.
+///
+/// Useful for std::vector of uint<N> to have the elements aligned to the cache lines
+/// or to the vector width.
+template <typename T, size_t Alignment = 64>
+struct aligned_allocator
+{
+    static_assert((Alignment & (Alignment - 1)) == 0, "alignment must be a power of 2");
+
+    static constexpr size_t alignment = std::max(Alignment, alignof(T));
+
+    using value_type = T;
+
+    template <typename U>
+    struct rebind
+    {
+        using other = aligned_allocator<U, Alignment>;
+    };
+
+    constexpr aligned_allocator() noexcept = default;
+
+    template <typename U>
+    constexpr aligned_allocator(const aligned_allocator<U, Alignment>&) noexcept  // NOLINT
+    {}
+
+    [[nodiscard]] T* allocate(size_t n)
+    {
+        if (n > std::numeric_limits<size_t>::max() / sizeof(T))
+            throw_<std::length_error>("too many elements");
+        return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{alignment}));
+    }
+
+    void deallocate(T* p, size_t) noexcept { ::operator delete(p, std::align_val_t{alignment}); }
+};
+
+template <typename T, typename U, size_t Alignment>
+inline constexpr bool operator==(
+    const aligned_allocator<T, Alignment>&, const aligned_allocator<U, Alignment>&) noexcept
+{
+    return true;
+}
+
+template <typename T, typename U, size_t Alignment>
+inline constexpr bool operator!=(
+    const aligned_allocator<T, Alignment>&, const aligned_allocator<U, Alignment>&) noexcept
+{
+    return false;
+}
+}  // namespace intx
@@ -0,0 +1,435 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+/// @file
+/// Elliptic curve point arithmetic over 256-bit prime fields.
+///
+/// The short Weierstrass curves y^2 = x^3 + ax + b are supported. The predefined curves are
+/// secp256k1, P-256 (secp256r1) and the G1 group of BN254 (alt_bn128).
+///
+/// The field elements are kept in the Montgomery form so the field multiplication needs
+/// no division. The points are computed in the Jacobian coordinates (X/Z^2, Y/Z^3)
+/// so the field inversion is only needed for the conversion back to the affine coordinates.
+
+#pragma once
+
+#include <intx/montgomery.hpp>
+#include <vector>
+
+namespace intx
+{
+namespace ec
+{
+/// The point in the affine coordinates. The point at infinity is represented by (0, 0).
+struct affine_point
+{
+    uint256 x;
+    uint256 y;
+
+    friend constexpr bool operator==(const affine_point& a, const affine_point& b) noexcept
+    {
+        return a.x == b.x && a.y == b.y;
+    }
+
+    friend constexpr bool operator!=(const affine_point& a, const affine_point& b) noexcept
+    {
+        return !(a == b);
+    }
+};
+
+/// The point in the Jacobian coordinates with the coordinates in the Montgomery form.
+/// The point at infinity has z = 0.
+struct jacobian_point
+{
+    uint256 x;
+    uint256 y;
+    uint256 z;
+};
+
+/// The elliptic curve y^2 = x^3 + ax + b over the prime field of at most 256 bits.
+///
+/// The curve object keeps the precomputed comb table of the generator multiples
+/// for the fixed-base scalar multiplication. The affine points in the interface are
+/// in the regular form, the Jacobian points are in the Montgomery form.
+///
+/// The scalar multiplications are variable-time: the branches and the table lookups depend
+/// on the scalar. Do not use them with secret scalars (private keys, nonces), e.g. for signing.
+class curve
+{
+    /// The number of teeth of the fixed-base comb.
+    static constexpr unsigned comb_teeth = 8;
+
+    /// The distance between the comb teeth in bits.
+    static constexpr unsigned comb_spacing = 256 / comb_teeth;
+
+    static_assert(comb_spacing == 32, "mul_g() collects 2 teeth from every word");
+
+    /// The number of bits of the window of the variable-base scalar multiplication.
+    static constexpr unsigned window_bits = 4;
+
+    enum class a_kind
+    {
+        zero,
+        minus3,
+        generic,
+    };
+
+    montgomery<256> f_;
+    uint256 order_;
+    a_kind a_kind_;
+    uint256 a_;  ///< The a coefficient in the Montgomery form.
+    uint256 b_;  ///< The b coefficient in the Montgomery form.
+    affine_point g_;
+
+    /// The comb table in the Montgomery form: the entry i is the sum of 2^(j * spacing) G
+    /// for all bits j set in i. The entry 0 is the point at infinity.
+    std::vector<affine_point> comb_;
+
+public:
+    /// Creates the curve over the field of the prime p with the generator g of the order n.
+    curve(const uint256& p, const uint256& n, const uint256& a, const uint256& b,
+        const affine_point& g)
+      : f_{p}, order_{n}, a_{f_.to_mont(a)}, b_{f_.to_mont(b)}, g_{g}
+    {
+        if (a == 0)
+            a_kind_ = a_kind::zero;
+        else if (a == p - 3)
+            a_kind_ = a_kind::minus3;
+        else
+            a_kind_ = a_kind::generic;
+
+        build_comb();
+    }
+
+    [[nodiscard]] const montgomery<256>& field() const noexcept { return f_; }
+    [[nodiscard]] const uint256& order() const noexcept { return order_; }
+    [[nodiscard]] const affine_point& generator() const noexcept { return g_; }
+
+    /// Checks if the point is on the curve. The point at infinity is reported as not valid.
+    [[nodiscard]] bool is_on_curve(const affine_point& p) const noexcept
+    {
+        const auto& m = f_.mod();
+        if (p.x >= m || p.y >= m || (p.x == 0 && p.y == 0))
+            return false;
+
+        const auto x = f_.to_mont(p.x);
+        const auto y = f_.to_mont(p.y);
+        auto rhs = f_.add(f_.mul(f_.mul(x, x), x), b_);
+        if (a_kind_ != a_kind::zero)
+            rhs = f_.add(rhs, f_.mul(a_, x));
+        return f_.mul(y, y) == rhs;
+    }
+
+    [[nodiscard]] jacobian_point to_jacobian(const affine_point& p) const noexcept
+    {
+        if (p.x == 0 && p.y == 0)
+            return {};
+        return {f_.to_mont(p.x), f_.to_mont(p.y), f_.one()};
+    }
+
+    [[nodiscard]] affine_point to_affine(const jacobian_point& p) const noexcept
+    {
+        if (p.z == 0)
+            return {};
+        const auto z_inv = f_.inv(p.z);
+        const auto z_inv2 = f_.mul(z_inv, z_inv);
+        const auto z_inv3 = f_.mul(z_inv2, z_inv);
+        return {f_.from_mont(f_.mul(p.x, z_inv2)), f_.from_mont(f_.mul(p.y, z_inv3))};
+    }
+
+    /// Point doubling.
+    ///
+    /// Uses the formulas dbl-2009-l for a = 0, dbl-2001-b for a = -3
+    /// and dbl-2007-bl otherwise from the Explicit-Formulas Database.
+    [[nodiscard]] jacobian_point dbl(const jacobian_point& p) const noexcept
+    {
+        if (p.z == 0)
+            return p;
+
+        const auto& f = f_;
+        jacobian_point r;
+        if (a_kind_ == a_kind::minus3)
+        {
+            const auto delta = f.mul(p.z, p.z);
+            const auto gamma = f.mul(p.y, p.y);
+            const auto beta = f.mul(p.x, gamma);
+            const auto t = f.mul(f.sub(p.x, delta), f.add(p.x, delta));
+            const auto alpha = f.add(f.add(t, t), t);
+            const auto beta4 = dbl2(beta);
+            r.x = f.sub(f.mul(alpha, alpha), f.add(beta4, beta4));
+            const auto yz = f.add(p.y, p.z);
+            r.z = f.sub(f.sub(f.mul(yz, yz), gamma), delta);
+            const auto gamma2 = f.mul(gamma, gamma);
+            r.y = f.sub(f.mul(alpha, f.sub(beta4, r.x)), dbl3(gamma2));
+        }
+        else
+        {
+            const auto xx = f.mul(p.x, p.x);
+            const auto yy = f.mul(p.y, p.y);
+            const auto yyyy = f.mul(yy, yy);
+            const auto xyy = f.add(p.x, yy);
+            const auto t = f.sub(f.sub(f.mul(xyy, xyy), xx), yyyy);
+            const auto s = f.add(t, t);
+            auto m = f.add(f.add(xx, xx), xx);
+            if (a_kind_ == a_kind::generic)
+            {
+                const auto zz = f.mul(p.z, p.z);
+                m = f.add(m, f.mul(a_, f.mul(zz, zz)));
+            }
+            r.x = f.sub(f.mul(m, m), f.add(s, s));
+            r.y = f.sub(f.mul(m, f.sub(s, r.x)), dbl3(yyyy));
+            const auto yz = f.mul(p.y, p.z);
+            r.z = f.add(yz, yz);
+        }
+        return r;
+    }
+
+    /// Point addition (add-2007-bl).
+    [[nodiscard]] jacobian_point add(
+        const jacobian_point& p, const jacobian_point& q) const noexcept
+    {
+        if (p.z == 0)
+            return q;
+        if (q.z == 0)
+            return p;
+
+        const auto& f = f_;
+        const auto z1z1 = f.mul(p.z, p.z);
+        const auto z2z2 = f.mul(q.z, q.z);
+        const auto u1 = f.mul(p.x, z2z2);
+        const auto u2 = f.mul(q.x, z1z1);
+        const auto s1 = f.mul(f.mul(p.y, q.z), z2z2);
+        const auto s2 = f.mul(f.mul(q.y, p.z), z1z1);
+        const auto h = f.sub(u2, u1);
+        const auto s = f.sub(s2, s1);
+        if (h == 0)
+            return s == 0 ? dbl(p) : jacobian_point{};
+
+        const auto h2 = f.add(h, h);
+        const auto i = f.mul(h2, h2);
+        const auto j = f.mul(h, i);
+        const auto r = f.add(s, s);
+        const auto v = f.mul(u1, i);
+
+        jacobian_point res;
+        res.x = f.sub(f.sub(f.mul(r, r), j), f.add(v, v));
+        const auto s1j = f.mul(s1, j);
+        res.y = f.sub(f.mul(r, f.sub(v, res.x)), f.add(s1j, s1j));
+        const auto z1z2 = f.add(p.z, q.z);
+        res.z = f.mul(f.sub(f.sub(f.mul(z1z2, z1z2), z1z1), z2z2), h);
+        return res;
+    }
+
+    /// Mixed point addition (madd-2007-bl) of the affine point q in the Montgomery form.
+    [[nodiscard]] jacobian_point add_mixed(
+        const jacobian_point& p, const affine_point& q) const noexcept
+    {
+        if (q.x == 0 && q.y == 0)
+            return p;
+        if (p.z == 0)
+            return {q.x, q.y, f_.one()};
+
+        const auto& f = f_;
+        const auto z1z1 = f.mul(p.z, p.z);
+        const auto u2 = f.mul(q.x, z1z1);
+        const auto s2 = f.mul(f.mul(q.y, p.z), z1z1);
+        const auto h = f.sub(u2, p.x);
+        const auto s = f.sub(s2, p.y);
+        if (h == 0)
+            return s == 0 ? dbl(p) : jacobian_point{};
+
+        const auto hh = f.mul(h, h);
+        const auto i = dbl2(hh);
+        const auto j = f.mul(h, i);
+        const auto r = f.add(s, s);
+        const auto v = f.mul(p.x, i);
+
+        jacobian_point res;
+        res.x = f.sub(f.sub(f.mul(r, r), j), f.add(v, v));
+        const auto y1j = f.mul(p.y, j);
+        res.y = f.sub(f.mul(r, f.sub(v, res.x)), f.add(y1j, y1j));
+        const auto z1h = f.add(p.z, h);
+        res.z = f.sub(f.sub(f.mul(z1h, z1h), z1z1), hh);
+        return res;
+    }
+
+    [[nodiscard]] jacobian_point negate(const jacobian_point& p) const noexcept
+    {
+        return {p.x, f_.sub(0, p.y), p.z};
+    }
+
+    /// Variable-base scalar multiplication k * P with the fixed window of 4 bits.
+    /// Variable-time, not for secret k.
+    [[nodiscard]] jacobian_point mul(const jacobian_point& p, const uint256& k) const noexcept
+    {
+        constexpr auto table_size = 1u << window_bits;
+        jacobian_point table[table_size];
+        table[1] = p;
+        for (size_t i = 2; i < table_size; ++i)
+            table[i] = (i % 2 == 0) ? dbl(table[i / 2]) : add(table[i - 1], p);
+
+        jacobian_point r;
+        for (auto i = 256 / window_bits; i-- != 0;)
+        {
+            if (r.z != 0)
+            {
+                for (unsigned j = 0; j < window_bits; ++j)
+                    r = dbl(r);
+            }
+            const auto bit_index = i * window_bits;
+            const auto w = (k[bit_index / 64] >> (bit_index % 64)) & (table_size - 1);
+            if (w != 0)
+                r = add(r, table[w]);
+        }
+        return r;
+    }
+
+    /// Fixed-base scalar multiplication k * G with the comb method: 31 doublings
+    /// and 32 mixed additions with the precomputed table. Variable-time, not for secret k.
+    [[nodiscard]] jacobian_point mul_g_jacobian(const uint256& k) const noexcept
+    {
+        jacobian_point r;
+        for (auto i = comb_spacing; i-- != 0;)
+        {
+            r = dbl(r);
+
+            // Collect the bits i + j * spacing. For the spacing of 32 bits
+            // the word w contains the teeth 2w and 2w + 1.
+            size_t index = 0;
+            for (size_t w = 0; w < uint256::num_words; ++w)
+            {
+                index |= ((k[w] >> i) & 1) << (2 * w);
+                index |= ((k[w] >> (i + comb_spacing)) & 1) << (2 * w + 1);
+            }
+            r = add_mixed(r, comb_[index]);
+        }
+        return r;
+    }
+
+    /// Computes k * P for the affine point P. Variable-time, not for secret k.
+    [[nodiscard]] affine_point mul(const affine_point& p, const uint256& k) const noexcept
+    {
+        return to_affine(mul(to_jacobian(p), k));
+    }
+
+    /// Computes k * G. Variable-time, not for secret k.
+    [[nodiscard]] affine_point mul_g(const uint256& k) const noexcept
+    {
+        return to_affine(mul_g_jacobian(k));
+    }
+
+    /// Computes u1 * G + u2 * Q, e.g. for the ECDSA verification and public key recovery.
+    [[nodiscard]] affine_point double_mul(
+        const uint256& u1, const uint256& u2, const affine_point& q) const noexcept
+    {
+        return to_affine(add(mul_g_jacobian(u1), mul(to_jacobian(q), u2)));
+    }
+
+    /// Computes P + Q for the affine points.
+    [[nodiscard]] affine_point add(const affine_point& p, const affine_point& q) const noexcept
+    {
+        return to_affine(add(to_jacobian(p), to_jacobian(q)));
+    }
+
+private:
+    [[nodiscard]] uint256 dbl2(const uint256& x) const noexcept
+    {
+        const auto x2 = f_.add(x, x);
+        return f_.add(x2, x2);
+    }
+
+    [[nodiscard]] uint256 dbl3(const uint256& x) const noexcept
+    {
+        const auto x4 = dbl2(x);
+        return f_.add(x4, x4);
+    }
+
+    void build_comb()
+    {
+        constexpr auto table_size = size_t{1} << comb_teeth;
+
+        jacobian_point teeth[comb_teeth];
+        teeth[0] = to_jacobian(g_);
+        for (size_t j = 1; j < comb_teeth; ++j)
+        {
+            teeth[j] = teeth[j - 1];
+            for (unsigned i = 0; i < comb_spacing; ++i)
+                teeth[j] = dbl(teeth[j]);
+        }
+
+        std::vector<jacobian_point> table(table_size);
+        for (size_t i = 1; i < table_size; ++i)
+        {
+            const auto top = 63 - clz(uint64_t{i});
+            table[i] = add(table[i ^ (size_t{1} << top)], teeth[top]);
+        }
+
+        // Convert to the affine coordinates with a single inversion (Montgomery's trick).
+        std::vector<uint256> prefix(table_size);
+        auto acc = f_.one();
+        for (size_t i = 0; i < table_size; ++i)
+        {
+            prefix[i] = acc;
+            if (table[i].z != 0)
+                acc = f_.mul(acc, table[i].z);
+        }
+        auto acc_inv = f_.inv(acc);
+
+        comb_.resize(table_size);
+        for (size_t i = table_size; i-- != 0;)
+        {
+            const auto& p = table[i];
+            if (p.z == 0)
+                continue;
+            const auto z_inv = f_.mul(acc_inv, prefix[i]);
+            acc_inv = f_.mul(acc_inv, p.z);
+            const auto z_inv2 = f_.mul(z_inv, z_inv);
+            comb_[i] = {f_.mul(p.x, z_inv2), f_.mul(p.y, f_.mul(z_inv2, z_inv))};
+        }
+    }
+};
+
+/// The secp256k1 curve used by Bitcoin and Ethereum signatures.
+inline const curve& secp256k1()
+{
+    static const curve c{
+        0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f_u256,
+        0xfffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141_u256,
+        0,
+        7,
+        {0x79be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798_u256,
+            0x483ada7726a3c4655da4fbfc0e1108a8fd17b448a68554199c47d08ffb10d4b8_u256},
+    };
+    return c;
+}
+
+/// The NIST P-256 (secp256r1) curve.
+inline const curve& p256()
+{
+    constexpr auto p = 0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff_u256;
+    static const curve c{
+        p,
+        0xffffffff00000000ffffffffffffffffbce6faada7179e84f3b9cac2fc632551_u256,
+        p - 3,
+        0x5ac635d8aa3a93e7b3ebbd55769886bc651d06b0cc53b0f63bce3c3e27d2604b_u256,
+        {0x6b17d1f2e12c4247f8bce6e563a440f277037d812deb33a0f4a13945d898c296_u256,
+            0x4fe342e2fe1a7f9b8ee7eb4a7c0f9e162bce33576b315ececbb6406837bf51f5_u256},
+    };
+    return c;
+}
+
+/// The G1 group of the BN254 (alt_bn128) pairing-friendly curve.
+inline const curve& bn254()
+{
+    static const curve c{
+        0x30644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd47_u256,
+        0x30644e72e131a029b85045b68181585d2833e84879b9709143e1f593f0000001_u256,
+        0,
+        3,
+        {1, 2},
+    };
+    return c;
+}
+}  // namespace ec
+}  // namespace intx
@@ -0,0 +1,233 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+/// @file
+/// Fused arithmetic kernels and the opt-in expression layer dispatching to them.
+///
+/// The plain uint<N> operators evaluate every subexpression into an N-bit temporary,
+/// e.g. `a * b % m` first computes the truncated product. The expressions built from
+/// operands wrapped with fused::lazy() are evaluated with the full precision intermediate
+/// values and the recognized patterns are computed by dedicated kernels:
+///
+/// - `lazy(a) * b % m`            -> mulmod(a, b, m),
+/// - `lazy(a) * b / d`            -> mul_div(a, b, d),
+/// - `(lazy(a) + b) % m`          -> addmod(a, b, m),
+/// - `(lazy(a) * b + c) % m`      -> umul_add(a, b, c) reduced modulo m,
+/// - `(lazy(a) * b + lazy(c) * d) % m` and other sums of products
+///                                -> the sum of the full products reduced modulo m.
+///
+/// An expression not followed by % or / converts to uint<N> with the usual
+/// (truncating) semantics.
+
+#pragma once
+
+#include <intx/intx.hpp>
+
+namespace intx
+{
+/// Computes x * y / d using the full 2N-bit intermediate product.
+/// The quotient is truncated to N bits.
+template <unsigned N>
+inline uint<N> mul_div(const uint<N>& x, const uint<N>& y, const uint<N>& d) noexcept
+{
+    return static_cast<uint<N>>(udiv(umul(x, y), d));
+}
+
+namespace fused
+{
+template <unsigned N>
+struct term;
+
+template <typename L, typename R>
+struct sum;
+
+template <typename E>
+uint<E::num_bits> reduce_mod(const E& e, const uint<E::num_bits>& m) noexcept;
+
+template <typename E>
+uint<E::num_bits> reduce_div(const E& e, const uint<E::num_bits>& d) noexcept;
+
+/// The base of the expression types E providing the operators with uint<N> operands.
+///
+/// The operators are hidden friends, i.e. non-template functions found by ADL.
+/// This way they are preferred over the intx mixed-type operator templates
+/// which also accept the expressions as they are convertible to uint<N>.
+template <typename E, unsigned N>
+struct expr
+{
+    static constexpr unsigned num_bits = N;
+
+    friend uint<N> operator%(const E& e, const uint<N>& m) noexcept { return reduce_mod(e, m); }
+
+    friend uint<N> operator/(const E& e, const uint<N>& d) noexcept { return reduce_div(e, d); }
+
+    friend constexpr sum<E, term<N>> operator+(const E& l, const uint<N>& r) noexcept
+    {
+        return {l, term<N>{r}};
+    }
+
+    friend constexpr sum<term<N>, E> operator+(const uint<N>& l, const E& r) noexcept
+    {
+        return {term<N>{l}, r};
+    }
+};
+
+/// The product of two operands. The full product has 2N bits.
+template <unsigned N>
+struct product : expr<product<N>, N>
+{
+    static constexpr unsigned wide_num_bits = 2 * N;
+
+    uint<N> x;
+    uint<N> y;
+
+    constexpr product(const uint<N>& a, const uint<N>& b) noexcept : x{a}, y{b} {}
+
+    [[nodiscard]] constexpr uint<N> value() const noexcept { return x * y; }
+    [[nodiscard]] constexpr uint<2 * N> wide() const noexcept { return umul(x, y); }
+
+    constexpr operator uint<N>() const noexcept { return value(); }  // NOLINT
+};
+
+/// The expression leaf: a single uint<N> operand.
+template <unsigned N>
+struct term : expr<term<N>, N>
+{
+    static constexpr unsigned wide_num_bits = N;
+
+    uint<N> x;
+
+    constexpr explicit term(const uint<N>& a) noexcept : x{a} {}
+
+    [[nodiscard]] constexpr uint<N> value() const noexcept { return x; }
+    [[nodiscard]] constexpr uint<N> wide() const noexcept { return x; }
+
+    constexpr operator uint<N>() const noexcept { return value(); }  // NOLINT
+
+    friend constexpr product<N> operator*(const term& a, const term& b) noexcept
+    {
+        return {a.x, b.x};
+    }
+
+    friend constexpr product<N> operator*(const term& a, const uint<N>& b) noexcept
+    {
+        return {a.x, b};
+    }
+
+    friend constexpr product<N> operator*(const uint<N>& a, const term& b) noexcept
+    {
+        return {a, b.x};
+    }
+};
+
+/// The sum of two subexpressions. The full sum needs one more word than the wider one,
+/// except the sum of a product and an operand which fits the 2N-bit umul_add() result.
+template <typename L, typename R>
+struct sum : expr<sum<L, R>, L::num_bits>
+{
+    static_assert(L::num_bits == R::num_bits, "mixed-width expressions are not supported");
+
+    static constexpr unsigned num_bits = L::num_bits;
+
+    /// The product + operand and operand + product patterns.
+    static constexpr bool is_mac_lr =
+        std::is_same_v<L, product<num_bits>> && std::is_same_v<R, term<num_bits>>;
+    static constexpr bool is_mac_rl =
+        std::is_same_v<L, term<num_bits>> && std::is_same_v<R, product<num_bits>>;
+    static constexpr bool is_mac = is_mac_lr || is_mac_rl;
+
+    static constexpr unsigned wide_num_bits =
+        is_mac ? 2 * num_bits : std::max(L::wide_num_bits, R::wide_num_bits) + 64;
+
+    L l;
+    R r;
+
+    constexpr sum(const L& a, const R& b) noexcept : l{a}, r{b} {}
+
+    [[nodiscard]] constexpr uint<num_bits> value() const noexcept
+    {
+        if constexpr (is_mac_lr)
+            return mul_add(l.x, l.y, r.x);
+        else if constexpr (is_mac_rl)
+            return mul_add(r.x, r.y, l.x);
+        else
+            return l.value() + r.value();
+    }
+
+    [[nodiscard]] constexpr uint<wide_num_bits> wide() const noexcept
+    {
+        if constexpr (is_mac_lr)
+            return umul_add(l.x, l.y, r.x);
+        else if constexpr (is_mac_rl)
+            return umul_add(r.x, r.y, l.x);
+        else
+            return uint<wide_num_bits>{l.wide()} + uint<wide_num_bits>{r.wide()};
+    }
+
+    constexpr operator uint<num_bits>() const noexcept { return value(); }  // NOLINT
+};
+
+template <typename T, typename = void>
+struct is_expr : std::false_type
+{};
+
+template <typename T>
+struct is_expr<T, std::void_t<decltype(T::num_bits)>>
+  : std::bool_constant<std::is_base_of_v<expr<T, T::num_bits>, T>>
+{};
+
+template <typename T>
+inline constexpr bool is_expr_v = is_expr<T>::value;
+
+
+/// Wraps the operand to start a fused expression.
+template <unsigned N>
+inline constexpr term<N> lazy(const uint<N>& x) noexcept
+{
+    return term<N>{x};
+}
+
+template <typename L, typename R, typename = std::enable_if_t<is_expr_v<L> && is_expr_v<R>>>
+inline constexpr sum<L, R> operator+(const L& l, const R& r) noexcept
+{
+    return {l, r};
+}
+
+/// Reduces the full precision value of the expression modulo m.
+template <typename E>
+inline uint<E::num_bits> reduce_mod(const E& e, const uint<E::num_bits>& m) noexcept
+{
+    constexpr auto N = E::num_bits;
+
+    if constexpr (std::is_same_v<E, product<N>>)
+    {
+        if constexpr (N == 256)
+            return mulmod(e.x, e.y, m);
+        else
+            return umod(umul(e.x, e.y), m);
+    }
+    else if constexpr (N == 256 && std::is_same_v<E, sum<term<N>, term<N>>>)
+        return addmod(e.l.x, e.r.x, m);
+    else if constexpr (E::wide_num_bits == N)
+        return e.value() % m;
+    else
+        return umod(e.wide(), m);
+}
+
+/// Divides the full precision value of the expression by d.
+/// The quotient is truncated to N bits.
+template <typename E>
+inline uint<E::num_bits> reduce_div(const E& e, const uint<E::num_bits>& d) noexcept
+{
+    constexpr auto N = E::num_bits;
+
+    if constexpr (std::is_same_v<E, product<N>>)
+        return mul_div(e.x, e.y, d);
+    else if constexpr (E::wide_num_bits == N)
+        return e.value() / d;
+    else
+        return static_cast<uint<N>>(udiv(e.wide(), d));
+}
+}  // namespace fused
+}  // namespace intx
@@ -0,0 +1,95 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+/// @file
+/// Optional interoperability with the GMP library.
+///
+/// The conversions between uint<N> and mpz_t copy the words directly to/from the GMP limbs,
+/// without the round-trip through the decimal string. Requires linking with GMP.
+
+#pragma once
+
+#include <gmp.h>
+#include <intx/intx.hpp>
+#include <utility>
+
+namespace intx
+{
+static_assert(sizeof(mp_limb_t) == sizeof(uint64_t) && GMP_NAIL_BITS == 0,
+    "GMP limbs must be full 64-bit words");
+
+/// The read-only mpz_t view of the uint<N> value.
+///
+/// No memory is allocated and no words are copied: the view points to the words of the
+/// uint<N> object, which must outlive the view and not be modified while the view is in use.
+/// The view can be passed to any GMP function as the mpz_srcptr argument,
+/// but must never be modified or cleared.
+class mpz_view
+{
+    mpz_t z_;
+
+public:
+    template <unsigned N>
+    explicit mpz_view(const uint<N>& x) noexcept
+    {
+        const auto limbs = reinterpret_cast<const mp_limb_t*>(&x[0]);
+        mpz_roinit_n(z_, limbs, static_cast<mp_size_t>(uint<N>::num_words));
+    }
+
+    mpz_view(const mpz_view&) = delete;
+    mpz_view& operator=(const mpz_view&) = delete;
+
+    [[nodiscard]] mpz_srcptr get() const noexcept { return z_; }
+
+    operator mpz_srcptr() const noexcept { return z_; }  // NOLINT(hicpp-explicit-conversions)
+};
+
+/// Assigns the value of x to the initialized mpz_t r.
+///
+/// The words are written directly to the limbs of r. The r is reallocated only if it has
+/// not enough limbs allocated.
+template <unsigned N>
+inline void to_mpz(mpz_ptr r, const uint<N>& x)
+{
+    constexpr auto num_words = static_cast<mp_size_t>(uint<N>::num_words);
+    const auto p = mpz_limbs_write(r, num_words);
+    for (mp_size_t i = 0; i < num_words; ++i)
+        p[i] = x[static_cast<size_t>(i)];
+    mpz_limbs_finish(r, num_words);  // Removes the leading zero limbs.
+}
+
+/// Checks if the value of x fits uint<N>, i.e. 0 <= x < 2^N.
+template <unsigned N>
+inline bool fits(mpz_srcptr x) noexcept
+{
+    return mpz_sgn(x) >= 0 && mpz_size(x) <= uint<N>::num_words;
+}
+
+/// Converts the mpz_t value to uint<N> by reading its limbs.
+///
+/// The result is the value x modulo 2^N, i.e. the higher limbs are truncated
+/// and the negative values are in the two's complement form as for the uint<N> arithmetic.
+/// Use fits() to check if the conversion is exact.
+template <unsigned N>
+inline uint<N> from_mpz(mpz_srcptr x) noexcept
+{
+    const auto p = mpz_limbs_read(x);
+    const auto n = std::min(mpz_size(x), size_t{uint<N>::num_words});
+
+    uint<N> r;
+    for (size_t i = 0; i < n; ++i)
+        r[i] = p[i];
+    return mpz_sgn(x) < 0 ? -r : r;
+}
+
+/// Invokes fn with the read-only mpz_t views of the uint<N> arguments.
+///
+/// This dispatches the rare operations not provided by intx to GMP without any conversion
+/// cost, e.g. with_mpz([&](mpz_srcptr a, mpz_srcptr b) { mpz_gcd(r, a, b); }, x, y).
+template <typename Fn, unsigned... N>
+inline decltype(auto) with_mpz(Fn&& fn, const uint<N>&... args)
+{
+    return std::forward<Fn>(fn)(mpz_view{args}.get()...);
+}
+}  // namespace intx
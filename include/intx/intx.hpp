@@ -14,6 +14,7 @@
 #include <string>
 #include <tuple>
 #include <type_traits>
+#include <utility>
 
 #ifndef __has_builtin
     #define __has_builtin(NAME) 0
@@ -62,6 +63,71 @@
     #define INTX_HAS_BUILTIN_INT128 0
 #endif
 
+// Detect compiler support for the unsigned _BitInt(N) types (Clang 14+).
+// The backend requires the little-endian layout of the _BitInt(N) words matching uint<N>.
+#if defined(__clang__) && defined(__BITINT_MAXWIDTH__) && defined(__BYTE_ORDER__) && \
+    __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    #define INTX_HAS_BITINT 1
+#else
+    #define INTX_HAS_BITINT 0
+#endif
+
+// The per-operation selection of the _BitInt(N) backend for the uint<N> operators.
+// Set to 1 to implement the operation with the compiler's unsigned _BitInt(N) arithmetic
+// where available. The default portable implementations are used in constant evaluation
+// and when INTX_HAS_BITINT is 0.
+#ifndef INTX_BITINT_ADD
+    #define INTX_BITINT_ADD 0  ///< Addition and subtraction.
+#endif
+#ifndef INTX_BITINT_CMP
+    #define INTX_BITINT_CMP 0  ///< Equality and less-than comparison.
+#endif
+#ifndef INTX_BITINT_SHIFT
+    #define INTX_BITINT_SHIFT 0  ///< Left and right shifts by uint64_t.
+#endif
+#ifndef INTX_BITINT_MUL
+    #define INTX_BITINT_MUL 0  ///< Truncating multiplication.
+#endif
+
+// Detect the hardware division of 128-bit numbers by 64-bit numbers (the x86-64 div instruction).
+#if defined(__x86_64__) && defined(__GNUC__)
+    #define INTX_HAS_HW_DIV_2BY1 1
+#else
+    #define INTX_HAS_HW_DIV_2BY1 0
+#endif
+
+// Detect the architectures without the carry flag (RISC-V). The carries are computed there
+// with the unsigned comparisons and the multiplications use the kernels ordering them
+// off the critical path (see internal::umul_flagless()).
+#ifndef INTX_HAS_CARRY_FLAG
+    #if defined(__riscv)
+        #define INTX_HAS_CARRY_FLAG 0
+    #else
+        #define INTX_HAS_CARRY_FLAG 1
+    #endif
+#endif
+
+// The algorithm thresholds. The values tuned for the host CPU can be generated by intx-tune
+// to a header which is used if INTX_TUNING_HEADER is defined to its name,
+// e.g. -DINTX_TUNING_HEADER='"intx_tuning.hpp"'. Define it for all files of the program
+// (the CMake option INTX_TUNING_HEADER does this for the intx target), otherwise
+// the inline functions using the thresholds have different definitions in different files.
+// Without the header, or for the thresholds missing in it, the defaults are used.
+#ifdef INTX_TUNING_HEADER
+    #include INTX_TUNING_HEADER
+#endif
+#ifndef INTX_DIVREM_1_RECIPROCAL_THRESHOLD
+    /// The min number of the numerator words divided by the word with the reciprocal
+    /// in divrem_1(). The shorter numerators are divided with the hardware division.
+    /// By default the reciprocal is always used: the hardware division is slower on many CPUs.
+    #define INTX_DIVREM_1_RECIPROCAL_THRESHOLD 1
+#endif
+#ifndef INTX_EQUAL_RANGE_LINEAR_THRESHOLD
+    /// The max length of the range where equal_range() switches from the binary search
+    /// to the linear scan.
+    #define INTX_EQUAL_RANGE_LINEAR_THRESHOLD 8
+#endif
+
 namespace intx
 {
 #if INTX_HAS_BUILTIN_INT128
@@ -155,7 +221,7 @@ inline constexpr bool is_constant_evaluated() noexcept
 inline constexpr uint64_t addc(
     uint64_t x, uint64_t y, unsigned long long* carry) noexcept // NOLINT(google-runtime-int)
 {
-#if __has_builtin(__builtin_addcll)
+#if INTX_HAS_CARRY_FLAG && __has_builtin(__builtin_addcll)
     if (!is_constant_evaluated())
     {
         return __builtin_addcll(x, y, *carry, carry);
@@ -170,6 +236,8 @@ inline constexpr uint64_t addc(
     }
 #endif
 
+    // Without the carry flag this is the shortest chain: the carry in goes through
+    // a single add, compare and or.
     const auto s = x + y;
     const auto t = s + *carry;
     *carry = uint64_t(s < x) | uint64_t(t < s);
@@ -180,7 +248,7 @@ inline constexpr uint64_t addc(
 inline constexpr uint64_t subc(
     uint64_t x, uint64_t y, unsigned long long* carry) noexcept // NOLINT(google-runtime-int)
 {
-#if __has_builtin(__builtin_subcll)
+#if INTX_HAS_CARRY_FLAG && __has_builtin(__builtin_subcll)
     if (!is_constant_evaluated())
     {
         return __builtin_subcll(x, y, *carry, carry);
@@ -1052,9 +1120,59 @@ using uint320 = uint<320>;
 using uint384 = uint<384>;
 using uint512 = uint<512>;
 
+/// Checks if the type T is a valid "other" operand of the mixed-type binary operators of uint<N>:
+/// it must be convertible to uint<N>, but not be uint<N> or a type derived from it.
+/// The derived types (e.g. aligned_uint<N>) use the uint<N> operators directly,
+/// otherwise the overloads for (uint<N>, T) and (T, uint<N>) would be ambiguous.
+template <typename T, unsigned N>
+inline constexpr bool is_foreign_operand_v =
+    std::is_convertible_v<T, uint<N>> && !std::is_base_of_v<uint<N>, T>;
+
+#if INTX_HAS_BITINT
+namespace internal
+{
+    #pragma clang diagnostic push
+    #pragma clang diagnostic ignored "-Wbit-int-extension"  // _BitInt is an extension in C++.
+
+/// The compiler's unsigned integer type of the same width as uint<N>.
+template <unsigned N>
+using bitint = unsigned _BitInt(N);
+
+    #pragma clang diagnostic pop
+
+/// Checks if the compiler supports the _BitInt(N) of the width of uint<N>.
+template <unsigned N>
+inline constexpr bool has_bitint = N <= __BITINT_MAXWIDTH__;
+
+template <unsigned N>
+inline bitint<N> to_bitint(const uint<N>& x) noexcept
+{
+    static_assert(sizeof(bitint<N>) == sizeof(x));
+    bitint<N> r;  // NOLINT(cppcoreguidelines-init-variables)
+    std::memcpy(&r, &x, sizeof(r));
+    return r;
+}
+
+template <unsigned N>
+inline uint<N> from_bitint(const bitint<N>& x) noexcept
+{
+    uint<N> r;
+    std::memcpy(&r, &x, sizeof(r));
+    return r;
+}
+}  // namespace internal
+#endif
+
 template <unsigned N>
 inline constexpr bool operator==(const uint<N>& x, const uint<N>& y) noexcept
 {
+#if INTX_HAS_BITINT && INTX_BITINT_CMP
+    if constexpr (internal::has_bitint<N>)
+    {
+        if (!is_constant_evaluated())
+            return internal::to_bitint(x) == internal::to_bitint(y);
+    }
+#endif
     uint64_t folded = 0;
     for (size_t i = 0; i < uint<N>::num_words; ++i)
         folded |= (x[i] ^ y[i]);
@@ -1062,14 +1180,14 @@ inline constexpr bool operator==(const uint<N>& x, const uint<N>& y) noexcept
 }
 
 template <unsigned N, typename T,
-    typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
+    typename = typename std::enable_if<is_foreign_operand_v<T, N>>::type>
 inline constexpr bool operator==(const uint<N>& x, const T& y) noexcept
 {
     return x == uint<N>(y);
 }
 
 template <unsigned N, typename T,
-    typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
+    typename = typename std::enable_if<is_foreign_operand_v<T, N>>::type>
 inline constexpr bool operator==(const T& x, const uint<N>& y) noexcept
 {
     return uint<N>(y) == x;
@@ -1083,14 +1201,14 @@ inline constexpr bool operator!=(const uint<N>& x, const uint<N>& y) noexcept
 }
 
 template <unsigned N, typename T,
-    typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
+    typename = typename std::enable_if<is_foreign_operand_v<T, N>>::type>
 inline constexpr bool operator!=(const uint<N>& x, const T& y) noexcept
 {
     return x != uint<N>(y);
 }
 
 template <unsigned N, typename T,
-    typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
+    typename = typename std::enable_if<is_foreign_operand_v<T, N>>::type>
 inline constexpr bool operator!=(const T& x, const uint<N>& y) noexcept
 {
     return uint<N>(x) != y;
@@ -1099,6 +1217,13 @@ inline constexpr bool operator!=(const T& x, const uint<N>& y) noexcept
 template <unsigned N>
 inline constexpr bool operator<(const uint<N>& x, const uint<N>& y) noexcept
 {
+#if INTX_HAS_BITINT && INTX_BITINT_CMP
+    if constexpr (internal::has_bitint<N>)
+    {
+        if (!is_constant_evaluated())
+            return internal::to_bitint(x) < internal::to_bitint(y);
+    }
+#endif
     for (size_t i = uint<N>::num_words; i-- > 1; ) {
         if (x[i] != y[i])
             return x[i] < y[i];
@@ -1107,14 +1232,14 @@ inline constexpr bool operator<(const uint<N>& x, const uint<N>& y) noexcept
 }
 
 template <unsigned N, typename T,
-    typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
+    typename = typename std::enable_if<is_foreign_operand_v<T, N>>::type>
 inline constexpr bool operator<(const uint<N>& x, const T& y) noexcept
 {
     return x < uint<N>(y);
 }
 
 template <unsigned N, typename T,
-    typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
+    typename = typename std::enable_if<is_foreign_operand_v<T, N>>::type>
 inline constexpr bool operator<(const T& x, const uint<N>& y) noexcept
 {
     return uint<N>(x) < y;
@@ -1128,14 +1253,14 @@ inline constexpr bool operator>(const uint<N>& x, const uint<N>& y) noexcept
 }
 
 template <unsigned N, typename T,
-    typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
+    typename = typename std::enable_if<is_foreign_operand_v<T, N>>::type>
 inline constexpr bool operator>(const uint<N>& x, const T& y) noexcept
 {
     return x > uint<N>(y);
 }
 
 template <unsigned N, typename T,
-    typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
+    typename = typename std::enable_if<is_foreign_operand_v<T, N>>::type>
 inline constexpr bool operator>(const T& x, const uint<N>& y) noexcept
 {
     return uint<N>(x) > y;
@@ -1149,14 +1274,14 @@ inline constexpr bool operator>=(const uint<N>& x, const uint<N>& y) noexcept
 }
 
 template <unsigned N, typename T,
-    typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
+    typename = typename std::enable_if<is_foreign_operand_v<T, N>>::type>
 inline constexpr bool operator>=(const uint<N>& x, const T& y) noexcept
 {
     return x >= uint<N>(y);
 }
 
 template <unsigned N, typename T,
-    typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
+    typename = typename std::enable_if<is_foreign_operand_v<T, N>>::type>
 inline constexpr bool operator>=(const T& x, const uint<N>& y) noexcept
 {
     return uint<N>(x) >= y;
@@ -1170,14 +1295,14 @@ inline constexpr bool operator<=(const uint<N>& x, const uint<N>& y) noexcept
 }
 
 template <unsigned N, typename T,
-    typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
+    typename = typename std::enable_if<is_foreign_operand_v<T, N>>::type>
 inline constexpr bool operator<=(const uint<N>& x, const T& y) noexcept
 {
     return x <= uint<N>(y);
 }
 
 template <unsigned N, typename T,
-    typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
+    typename = typename std::enable_if<is_foreign_operand_v<T, N>>::type>
 inline constexpr bool operator<=(const T& x, const uint<N>& y) noexcept
 {
     return uint<N>(x) <= y;
@@ -1238,6 +1363,11 @@ inline constexpr uint256 operator<<(const uint256& x, uint64_t shift) noexcept
     if (INTX_UNLIKELY(shift >= uint256::num_bits))
         return 0;
 
+#if INTX_HAS_BITINT && INTX_BITINT_SHIFT && __BITINT_MAXWIDTH__ >= 256
+    if (!is_constant_evaluated())
+        return internal::from_bitint<256>(internal::to_bitint(x) << shift);
+#endif
+
     constexpr auto num_bits = uint256::num_bits;
     constexpr auto half_bits = num_bits / 2;
 
@@ -1269,6 +1399,14 @@ inline constexpr uint<N> operator<<(const uint<N>& x, uint64_t shift) noexcept
     if (INTX_UNLIKELY(shift >= uint<N>::num_bits))
         return 0;
 
+#if INTX_HAS_BITINT && INTX_BITINT_SHIFT
+    if constexpr (internal::has_bitint<N>)
+    {
+        if (!is_constant_evaluated())
+            return internal::from_bitint<N>(internal::to_bitint(x) << shift);
+    }
+#endif
+
     constexpr auto word_bits = sizeof(uint64_t) * 8;
 
     const auto s = shift % word_bits;
@@ -1290,6 +1428,11 @@ inline constexpr uint256 operator>>(const uint256& x, uint64_t shift) noexcept
     if (INTX_UNLIKELY(shift >= uint256::num_bits))
         return 0;
 
+#if INTX_HAS_BITINT && INTX_BITINT_SHIFT && __BITINT_MAXWIDTH__ >= 256
+    if (!is_constant_evaluated())
+        return internal::from_bitint<256>(internal::to_bitint(x) >> shift);
+#endif
+
     constexpr auto num_bits = uint256::num_bits;
     constexpr auto half_bits = num_bits / 2;
 
@@ -1321,6 +1464,14 @@ inline constexpr uint<N> operator>>(const uint<N>& x, uint64_t shift) noexcept
     if (INTX_UNLIKELY(shift >= uint<N>::num_bits))
         return 0;
 
+#if INTX_HAS_BITINT && INTX_BITINT_SHIFT
+    if constexpr (internal::has_bitint<N>)
+    {
+        if (!is_constant_evaluated())
+            return internal::from_bitint<N>(internal::to_bitint(x) >> shift);
+    }
+#endif
+
     constexpr auto num_words = uint<N>::num_words;
     constexpr auto word_bits = sizeof(uint64_t) * 8;
 
@@ -1381,10 +1532,46 @@ inline constexpr uint<N> operator>>(const uint<N>& x, const T& shift) noexcept
     return 0;
 }
 
+/// The in-place left shift. The words are shifted directly in x without the temporary.
+template <unsigned N>
+inline constexpr uint<N>& operator<<=(uint<N>& x, uint64_t shift) noexcept
+{
+    constexpr auto num_words = uint<N>::num_words;
+    constexpr auto word_bits = sizeof(uint64_t) * 8;
+
+    if (INTX_UNLIKELY(shift >= uint<N>::num_bits))
+        return x = 0;
+
+    const auto s = shift % word_bits;
+    const auto skip = static_cast<size_t>(shift / word_bits);
+
+    for (size_t i = num_words - 1; i > skip; --i)
+        x[i] = (x[i - skip] << s) | ((x[i - skip - 1] >> (word_bits - s - 1)) >> 1);
+    x[skip] = x[0] << s;
+    for (size_t i = 0; i < skip; ++i)
+        x[i] = 0;
+    return x;
+}
+
+/// The in-place right shift. The words are shifted directly in x without the temporary.
 template <unsigned N>
 inline constexpr uint<N>& operator>>=(uint<N>& x, uint64_t shift) noexcept
 {
-    return x = x >> shift;
+    constexpr auto num_words = uint<N>::num_words;
+    constexpr auto word_bits = sizeof(uint64_t) * 8;
+
+    if (INTX_UNLIKELY(shift >= uint<N>::num_bits))
+        return x = 0;
+
+    const auto s = shift % word_bits;
+    const auto skip = static_cast<size_t>(shift / word_bits);
+
+    for (size_t i = 0; i < num_words - skip - 1; ++i)
+        x[i] = (x[i + skip] >> s) | ((x[i + skip + 1] << (word_bits - s - 1)) << 1);
+    x[num_words - skip - 1] = x[num_words - 1] >> s;
+    for (size_t i = num_words - skip; i < num_words; ++i)
+        x[i] = 0;
+    return x;
 }
 
 
@@ -1427,6 +1614,13 @@ inline const uint8_t* as_bytes(const T& x) noexcept
 template <unsigned N>
 inline constexpr uint<N> operator+(const uint<N>& x, const uint<N>& y) noexcept
 {
+#if INTX_HAS_BITINT && INTX_BITINT_ADD
+    if constexpr (internal::has_bitint<N>)
+    {
+        if (!is_constant_evaluated())
+            return internal::from_bitint<N>(internal::to_bitint(x) + internal::to_bitint(y));
+    }
+#endif
     unsigned long long carry = 0; // NOLINT(google-runtime-int)
     return addc(x, y, &carry);
 }
@@ -1440,6 +1634,13 @@ inline constexpr uint<N> operator-(const uint<N>& x) noexcept
 template <unsigned N>
 inline constexpr uint<N> operator-(const uint<N>& x, const uint<N>& y) noexcept
 {
+#if INTX_HAS_BITINT && INTX_BITINT_ADD
+    if constexpr (internal::has_bitint<N>)
+    {
+        if (!is_constant_evaluated())
+            return internal::from_bitint<N>(internal::to_bitint(x) - internal::to_bitint(y));
+    }
+#endif
     unsigned long long carry = 0; // NOLINT(google-runtime-int)
     return subc(x, y, &carry);
 }
@@ -1448,19 +1649,105 @@ template <unsigned N, typename T,
     typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
 inline constexpr uint<N>& operator+=(uint<N>& x, const T& y) noexcept
 {
-    return x = x + y;
+    const uint<N>& z = y;  // Not a copy if y is uint<N>. The z may alias x.
+    unsigned long long carry = 0; // NOLINT(google-runtime-int)
+    for (size_t i = 0; i < uint<N>::num_words; ++i)
+        x[i] = addc(x[i], z[i], &carry);
+    return x;
 }
 
 template <unsigned N, typename T,
     typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
 inline constexpr uint<N>& operator-=(uint<N>& x, const T& y) noexcept
 {
-    return x = x - y;
+    const uint<N>& z = y;  // Not a copy if y is uint<N>. The z may alias x.
+    unsigned long long borrow = 0; // NOLINT(google-runtime-int)
+    for (size_t i = 0; i < uint<N>::num_words; ++i)
+        x[i] = subc(x[i], z[i], &borrow);
+    return x;
+}
+
+namespace internal
+{
+/// The multiplication kernels for the architectures without the carry flag.
+///
+/// Each word product is first added to the word of the previous row, which is known
+/// in advance, and only then to the carry word k of the current row. The dependency chain
+/// through k is then a single add, compare and add instead of the chain of two additions
+/// with carries. The number of the carry computations (2 per product) is not changed.
+/// @{
+
+/// Computes the step of the row: p + r + k = hi:lo.
+inline constexpr uint64_t mul_step_flagless(
+    uint64_t x, uint64_t y, uint64_t r, uint64_t& k) noexcept
+{
+    const auto p = umul(x, y);
+    auto lo = p[0] + r;
+    auto hi = p[1] + (lo < r);  // No overflow: p[1] <= 2^64 - 2.
+    lo += k;
+    k = hi + (lo < k);
+    return lo;
+}
+
+template <unsigned N>
+inline constexpr uint<2 * N> umul_flagless(const uint<N>& x, const uint<N>& y) noexcept
+{
+    constexpr auto num_words = uint<N>::num_words;
+
+    uint<2 * N> p;
+    for (size_t j = 0; j < num_words; ++j)
+    {
+        uint64_t k = 0;
+        for (size_t i = 0; i < num_words; ++i)
+            p[i + j] = mul_step_flagless(x[i], y[j], p[i + j], k);
+        p[j + num_words] = k;
+    }
+    return p;
+}
+
+template <unsigned N>
+inline constexpr uint<N> mul_flagless(const uint<N>& x, const uint<N>& y) noexcept
+{
+    constexpr auto num_words = uint<N>::num_words;
+
+    uint<N> p;
+    for (size_t j = 0; j < num_words; ++j)
+    {
+        uint64_t k = 0;
+        for (size_t i = 0; i < (num_words - j - 1); ++i)
+            p[i + j] = mul_step_flagless(x[i], y[j], p[i + j], k);
+        p[num_words - 1] += x[num_words - j - 1] * y[j] + k;
+    }
+    return p;
+}
+
+/// r = x - multiplier * y. The product is subtracted from x before the borrow is,
+/// so the chain through the borrow is a single subtract, compare and add.
+inline uint64_t submul_flagless(
+    uint64_t r[], const uint64_t x[], const uint64_t y[], int len, uint64_t multiplier) noexcept
+{
+    INTX_REQUIRE(len >= 1);
+
+    uint64_t borrow = 0;
+    for (int i = 0; i < len; ++i)
+    {
+        const auto p = umul(y[i], multiplier);
+        const auto d = x[i] - p[0];
+        const auto b = p[1] + (x[i] < p[0]);  // No overflow: p[1] <= 2^64 - 2.
+        r[i] = d - borrow;
+        borrow = b + (d < borrow);
+    }
+    return borrow;
 }
+/// @}
+}  // namespace internal
 
 template <unsigned N>
 inline constexpr uint<2 * N> umul(const uint<N>& x, const uint<N>& y) noexcept
 {
+#if !INTX_HAS_CARRY_FLAG
+    return internal::umul_flagless(x, y);
+#else
     constexpr auto num_words = uint<N>::num_words;
 
     uint<2 * N> p;
@@ -1478,6 +1765,7 @@ inline constexpr uint<2 * N> umul(const uint<N>& x, const uint<N>& y) noexcept
         p[j + num_words] = k;
     }
     return p;
+#endif
 }
 
 /// Multiplication implementation using word access
@@ -1485,6 +1773,16 @@ inline constexpr uint<2 * N> umul(const uint<N>& x, const uint<N>& y) noexcept
 template <unsigned N>
 inline constexpr uint<N> operator*(const uint<N>& x, const uint<N>& y) noexcept
 {
+#if INTX_HAS_BITINT && INTX_BITINT_MUL
+    if constexpr (internal::has_bitint<N>)
+    {
+        if (!is_constant_evaluated())
+            return internal::from_bitint<N>(internal::to_bitint(x) * internal::to_bitint(y));
+    }
+#endif
+#if !INTX_HAS_CARRY_FLAG
+    return internal::mul_flagless(x, y);
+#else
     constexpr auto num_words = uint<N>::num_words;
 
     uint<N> p;
@@ -1502,13 +1800,185 @@ inline constexpr uint<N> operator*(const uint<N>& x, const uint<N>& y) noexcept
         p[num_words - 1] += x[num_words - j - 1] * y[j] + k;
     }
     return p;
+#endif
+}
+
+/// Full multiply-add: computes x * y + z + w.
+///
+/// The result never overflows 2N bits. The addends are accumulated in the same pass
+/// as the product: z initializes the low half of the result and the words of w
+/// are the initial carries of the rows of the multiplication.
+template <unsigned N>
+inline constexpr uint<2 * N> umul_add(
+    const uint<N>& x, const uint<N>& y, const uint<N>& z, const uint<N>& w = {}) noexcept
+{
+    constexpr auto num_words = uint<N>::num_words;
+
+    uint<2 * N> p;
+    for (size_t i = 0; i < num_words; ++i)
+        p[i] = z[i];
+
+    for (size_t j = 0; j < num_words; ++j)
+    {
+        uint64_t k = w[j];
+        for (size_t i = 0; i < num_words; ++i)
+        {
+            unsigned long long carry = 0; // NOLINT(google-runtime-int)
+            const auto a = addc(p[i + j], k, &carry);
+            const auto t = umul(x[i], y[j]) + uint128{a, carry};
+            p[i + j] = t[0];
+            k = t[1];
+        }
+        p[j + num_words] = k;
+    }
+    return p;
+}
+
+/// Multiply-add: computes x * y + z + w discarding the high part of the result.
+template <unsigned N>
+inline constexpr uint<N> mul_add(
+    const uint<N>& x, const uint<N>& y, const uint<N>& z, const uint<N>& w = {}) noexcept
+{
+    constexpr auto num_words = uint<N>::num_words;
+
+    uint<N> p = z;
+    for (size_t j = 0; j < num_words; j++)
+    {
+        uint64_t k = w[j];
+        for (size_t i = 0; i < (num_words - j - 1); i++)
+        {
+            unsigned long long carry = 0; // NOLINT(google-runtime-int)
+            const auto a = addc(p[i + j], k, &carry);
+            const auto t = umul(x[i], y[j]) + uint128{a, carry};
+            p[i + j] = t[0];
+            k = t[1];
+        }
+        p[num_words - 1] += x[num_words - j - 1] * y[j] + k;
+    }
+    return p;
+}
+
+namespace internal
+{
+/// Adds the row x * W * 2^(64 * J) of the multiplication by a constant to r.
+///
+/// The rows of the zero words are skipped. The multiplication by a power of 2 word
+/// is done by the shift and add.
+template <uint64_t W, size_t J, unsigned M, unsigned N>
+inline constexpr void mul_const_row(uint<M>& r, const uint<N>& x) noexcept
+{
+    constexpr auto num_words = uint<N>::num_words;
+    constexpr auto r_num_words = uint<M>::num_words;
+
+    if constexpr (W != 0 && J < r_num_words)
+    {
+        // The number of words of x contributing to the result.
+        constexpr auto len = std::min(num_words, r_num_words - J);
+
+        uint64_t k = 0;
+        if constexpr ((W & (W - 1)) == 0)
+        {
+            constexpr auto s = 63 - clz(W);
+            unsigned long long carry = 0; // NOLINT(google-runtime-int)
+            for (size_t i = 0; i < len; ++i)
+            {
+                const auto lo = i != 0 ? (x[i - 1] >> (63 - s)) >> 1 : 0;
+                r[J + i] = addc(r[J + i], (x[i] << s) | lo, &carry);
+            }
+            k = ((x[len - 1] >> (63 - s)) >> 1) + carry;
+        }
+        else
+        {
+            for (size_t i = 0; i < len; ++i)
+            {
+                unsigned long long carry = 0; // NOLINT(google-runtime-int)
+                const auto a = addc(r[J + i], k, &carry);
+                const auto p = umul(x[i], W) + uint128{a, carry};
+                r[J + i] = p[0];
+                k = p[1];
+            }
+        }
+
+        // The word above the row has not been written by the previous rows.
+        if constexpr (J + len < r_num_words)
+            r[J + len] = k;
+    }
+}
+
+template <uint64_t... C, size_t... J, unsigned M, unsigned N>
+inline constexpr void mul_const_rows(
+    uint<M>& r, const uint<N>& x, std::index_sequence<J...>) noexcept
+{
+    (mul_const_row<C, J>(r, x), ...);
+}
+}  // namespace internal
+
+/// Multiplies x by the compile-time constant and truncates the result to N bits.
+///
+/// The constant C is given by its 64-bit words, the least significant first,
+/// e.g. mul_const<1, 1>(x) computes x * (2^64 + 1). The multiplication is unrolled
+/// for the constant: the zero words are skipped and the power of 2 words are applied
+/// by the shift and add.
+template <uint64_t... C, unsigned N>
+inline constexpr uint<N> mul_const(const uint<N>& x) noexcept
+{
+    static_assert(sizeof...(C) != 0, "the constant must have at least one word");
+    uint<N> r;
+    internal::mul_const_rows<C...>(r, x, std::make_index_sequence<sizeof...(C)>{});
+    return r;
+}
+
+/// Multiplies x by the compile-time constant with the full precision result.
+///
+/// See mul_const() for the representation of the constant C, which must fit N bits.
+template <uint64_t... C, unsigned N>
+inline constexpr uint<2 * N> umul_const(const uint<N>& x) noexcept
+{
+    static_assert(sizeof...(C) != 0, "the constant must have at least one word");
+    static_assert(sizeof...(C) <= uint<N>::num_words, "the constant must fit N bits");
+    uint<2 * N> r;
+    internal::mul_const_rows<C...>(r, x, std::make_index_sequence<sizeof...(C)>{});
+    return r;
 }
 
 template <unsigned N, typename T,
     typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
 inline constexpr uint<N>& operator*=(uint<N>& x, const T& y) noexcept
 {
-    return x = x * y;
+    if constexpr (std::is_integral_v<T> && sizeof(T) <= sizeof(uint64_t))
+    {
+        // The multiplication by a single word is computed in place.
+        const auto w = static_cast<uint64_t>(y);
+        uint64_t k = 0;
+        for (size_t i = 0; i < uint<N>::num_words; ++i)
+        {
+            const auto p = umul(x[i], w) + k;
+            x[i] = p[0];
+            k = p[1];
+        }
+        return x;
+    }
+    else
+        return x = x * y;
+}
+
+/// Multiply-accumulate by a single word in place: r += x * y.
+///
+/// The r is updated word by word without the temporary for the product.
+/// Returns the highest word of the result not fitting r. The r may alias x.
+template <unsigned N>
+inline constexpr uint64_t addmul(uint<N>& r, const uint<N>& x, uint64_t y) noexcept
+{
+    uint64_t k = 0;
+    for (size_t i = 0; i < uint<N>::num_words; ++i)
+    {
+        unsigned long long carry = 0; // NOLINT(google-runtime-int)
+        const auto a = addc(r[i], k, &carry);
+        const auto p = umul(x[i], y) + uint128{a, carry};
+        r[i] = p[0];
+        k = p[1];
+    }
+    return k;
 }
 
 template <unsigned N>
@@ -1584,9 +2054,11 @@ struct normalized_div_args  // NOLINT(cppcoreguidelines-pro-type-member-init)
     unsigned shift;
 };
 
+/// Normalizes the division arguments of the already known numbers of significant words.
 template <unsigned M, unsigned N>
-[[gnu::always_inline]] inline normalized_div_args<M, N> normalize(
-    const uint<M>& numerator, const uint<N>& denominator) noexcept
+[[gnu::always_inline]] inline normalized_div_args<M, N> normalize_sized(const uint<M>& numerator,
+    const uint<N>& denominator, int num_significant_numerator_words,
+    int num_significant_denominator_words) noexcept
 {
     static constexpr auto num_numerator_words = uint<M>::num_words;
     static constexpr auto num_denominator_words = uint<N>::num_words;
@@ -1599,12 +2071,10 @@ template <unsigned M, unsigned N>
     auto* vn = as_words(na.divisor);
 
     auto& m = na.num_numerator_words;
-    for (m = num_numerator_words; m > 0 && u[m - 1] == 0; --m)
-        ;
+    m = num_significant_numerator_words;
 
     auto& n = na.num_divisor_words;
-    for (n = num_denominator_words; n > 0 && v[n - 1] == 0; --n)
-        ;
+    n = num_significant_denominator_words;
 
     na.shift = clz_nonzero(v[n - 1]);  // Use clz_nonzero() to avoid clang analyzer's warning.
     if (na.shift)
@@ -1631,6 +2101,15 @@ template <unsigned M, unsigned N>
     return na;
 }
 
+template <unsigned M, unsigned N>
+[[gnu::always_inline]] inline normalized_div_args<M, N> normalize(
+    const uint<M>& numerator, const uint<N>& denominator) noexcept
+{
+    return normalize_sized(numerator, denominator,
+        static_cast<int>(count_significant_words(numerator)),
+        static_cast<int>(count_significant_words(denominator)));
+}
+
 /// Divides arbitrary long unsigned integer by 64-bit unsigned integer (1 word).
 /// @param u    The array of a normalized numerator words. It will contain
 ///             the quotient after execution.
@@ -1655,6 +2134,21 @@ inline uint64_t udivrem_by1(uint64_t u[], int len, uint64_t d) noexcept
     return rem;
 }
 
+/// Computes the remainder of arbitrary long unsigned integer divided by 64-bit unsigned integer.
+/// As udivrem_by1() but the numerator is not modified, i.e. the quotient is not stored.
+inline uint64_t umod_by1(const uint64_t u[], int len, uint64_t d) noexcept
+{
+    INTX_REQUIRE(len >= 2);
+
+    const auto reciprocal = reciprocal_2by1(d);
+
+    auto rem = u[len - 1];
+    for (int i = len - 2; i >= 0; --i)
+        rem = udivrem_2by1({u[i], rem}, d, reciprocal).rem;
+
+    return rem;
+}
+
 /// Divides arbitrary long unsigned integer by 128-bit unsigned integer (2 words).
 /// @param u    The array of a normalized numerator words. It will contain the
 ///             quotient after execution.
@@ -1679,6 +2173,21 @@ inline uint128 udivrem_by2(uint64_t u[], int len, uint128 d) noexcept
     return rem;
 }
 
+/// Computes the remainder of arbitrary long unsigned integer divided by 128-bit unsigned integer.
+/// As udivrem_by2() but the numerator is not modified, i.e. the quotient is not stored.
+inline uint128 umod_by2(const uint64_t u[], int len, uint128 d) noexcept
+{
+    INTX_REQUIRE(len >= 3);
+
+    const auto reciprocal = reciprocal_3by2(d);
+
+    auto rem = uint128{u[len - 2], u[len - 1]};
+    for (int i = len - 3; i >= 0; --i)
+        rem = udivrem_3by2(rem[1], rem[0], u[i], d, reciprocal).rem;
+
+    return rem;
+}
+
 /// s = x + y.
 inline bool add(uint64_t s[], const uint64_t x[], const uint64_t y[], int len) noexcept
 {
@@ -1695,6 +2204,9 @@ inline bool add(uint64_t s[], const uint64_t x[], const uint64_t y[], int len) n
 inline uint64_t submul(
     uint64_t r[], const uint64_t x[], const uint64_t y[], int len, uint64_t multiplier) noexcept
 {
+#if !INTX_HAS_CARRY_FLAG
+    return internal::submul_flagless(r, x, y, len, multiplier);
+#else
     // OPT: Add MinLen template parameter and unroll first loop iterations.
     INTX_REQUIRE(len >= 1);
 
@@ -1708,8 +2220,13 @@ inline uint64_t submul(
         borrow += (s < r[i]);
     }
     return borrow;
+#endif
 }
 
+/// The Knuth's division of the normalized numerator u by the normalized divisor d.
+/// The numerator words are replaced with the remainder. The quotient digits are stored in q
+/// only if StoreQuotient is true, otherwise q is not accessed and may be null.
+template <bool StoreQuotient = true>
 inline void udivrem_knuth(
     uint64_t q[], uint64_t u[], int ulen, const uint64_t d[], int dlen) noexcept
 {
@@ -1749,39 +2266,39 @@ inline void udivrem_knuth(
             }
         }
 
-        q[j] = qhat;  // Store quotient digit.
+        if constexpr (StoreQuotient)
+            q[j] = qhat;  // Store quotient digit.
     }
 }
 
-}  // namespace internal
-
+/// The unsigned division of the arguments of the already known numbers of significant words.
 template <unsigned M, unsigned N>
-div_result<uint<M>, uint<N>> udivrem(const uint<M>& u, const uint<N>& v) noexcept
+[[gnu::always_inline]] inline div_result<uint<M>, uint<N>> udivrem_sized(
+    const uint<M>& u, const uint<N>& v, int num_u_words, int num_v_words) noexcept
 {
-    auto na = internal::normalize(u, v);
+    auto na = normalize_sized(u, v, num_u_words, num_v_words);
 
     if (na.num_numerator_words <= na.num_divisor_words)
         return {0, static_cast<uint<N>>(u)};
 
     if (na.num_divisor_words == 1)
     {
-        const auto r = internal::udivrem_by1(
-            as_words(na.numerator), na.num_numerator_words, as_words(na.divisor)[0]);
+        const auto r =
+            udivrem_by1(as_words(na.numerator), na.num_numerator_words, as_words(na.divisor)[0]);
         return {static_cast<uint<M>>(na.numerator), r >> na.shift};
     }
 
     if (na.num_divisor_words == 2)
     {
         const auto d = as_words(na.divisor);
-        const auto r =
-            internal::udivrem_by2(as_words(na.numerator), na.num_numerator_words, {d[0], d[1]});
+        const auto r = udivrem_by2(as_words(na.numerator), na.num_numerator_words, {d[0], d[1]});
         return {static_cast<uint<M>>(na.numerator), r >> na.shift};
     }
 
     auto un = as_words(na.numerator);  // Will be modified.
 
     uint<M> q;
-    internal::udivrem_knuth(
+    udivrem_knuth(
         as_words(q), &un[0], na.num_numerator_words, as_words(na.divisor), na.num_divisor_words);
 
     uint<N> r;
@@ -1793,6 +2310,86 @@ div_result<uint<M>, uint<N>> udivrem(const uint<M>& u, const uint<N>& v) noexcep
     return {q, r};
 }
 
+}  // namespace internal
+
+template <unsigned M, unsigned N>
+div_result<uint<M>, uint<N>> udivrem(const uint<M>& u, const uint<N>& v) noexcept
+{
+    return internal::udivrem_sized(u, v, static_cast<int>(count_significant_words(u)),
+        static_cast<int>(count_significant_words(v)));
+}
+
+/// Computes only the quotient of the unsigned division.
+///
+/// As udivrem() but the remainder is not de-normalized.
+template <unsigned M, unsigned N>
+uint<M> udiv(const uint<M>& u, const uint<N>& v) noexcept
+{
+    auto na = internal::normalize(u, v);
+
+    if (na.num_numerator_words <= na.num_divisor_words)
+        return 0;
+
+    if (na.num_divisor_words == 1)
+    {
+        internal::udivrem_by1(
+            as_words(na.numerator), na.num_numerator_words, as_words(na.divisor)[0]);
+        return static_cast<uint<M>>(na.numerator);
+    }
+
+    if (na.num_divisor_words == 2)
+    {
+        const auto d = as_words(na.divisor);
+        internal::udivrem_by2(as_words(na.numerator), na.num_numerator_words, {d[0], d[1]});
+        return static_cast<uint<M>>(na.numerator);
+    }
+
+    uint<M> q;
+    internal::udivrem_knuth(as_words(q), as_words(na.numerator), na.num_numerator_words,
+        as_words(na.divisor), na.num_divisor_words);
+    return q;
+}
+
+/// Computes only the remainder of the unsigned division.
+///
+/// As udivrem() but the quotient digits are not stored.
+template <unsigned M, unsigned N>
+uint<N> umod(const uint<M>& u, const uint<N>& v) noexcept
+{
+    auto na = internal::normalize(u, v);
+
+    if (na.num_numerator_words <= na.num_divisor_words)
+        return static_cast<uint<N>>(u);
+
+    if (na.num_divisor_words == 1)
+    {
+        const auto r = internal::umod_by1(
+            as_words(na.numerator), na.num_numerator_words, as_words(na.divisor)[0]);
+        return r >> na.shift;
+    }
+
+    if (na.num_divisor_words == 2)
+    {
+        const auto d = as_words(na.divisor);
+        const auto r =
+            internal::umod_by2(as_words(na.numerator), na.num_numerator_words, {d[0], d[1]});
+        return r >> na.shift;
+    }
+
+    auto un = as_words(na.numerator);  // Will be modified.
+
+    internal::udivrem_knuth<false>(
+        nullptr, &un[0], na.num_numerator_words, as_words(na.divisor), na.num_divisor_words);
+
+    uint<N> r;
+    auto rw = as_words(r);
+    for (int i = 0; i < na.num_divisor_words - 1; ++i)
+        rw[i] = na.shift ? (un[i] >> na.shift) | (un[i + 1] << (64 - na.shift)) : un[i];
+    rw[na.num_divisor_words - 1] = un[na.num_divisor_words - 1] >> na.shift;
+
+    return r;
+}
+
 template <unsigned N>
 inline constexpr div_result<uint<N>> sdivrem(const uint<N>& u, const uint<N>& v) noexcept
 {
@@ -1813,13 +2410,13 @@ inline constexpr div_result<uint<N>> sdivrem(const uint<N>& u, const uint<N>& v)
 template <unsigned N>
 inline constexpr uint<N> operator/(const uint<N>& x, const uint<N>& y) noexcept
 {
-    return udivrem(x, y).quot;
+    return udiv(x, y);
 }
 
 template <unsigned N>
 inline constexpr uint<N> operator%(const uint<N>& x, const uint<N>& y) noexcept
 {
-    return udivrem(x, y).rem;
+    return umod(x, y);
 }
 
 template <unsigned N, typename T,
@@ -1847,115 +2444,257 @@ inline constexpr uint<N> bswap(const uint<N>& x) noexcept
 }
 
 
+/// Word-scalar arithmetic.
+/// The kernels for the uint<N> and single word operands used by the mixed-type operators
+/// to avoid the promotion of the word to uint<N> and the full N-by-N algorithms.
+/// @{
+
+/// Checks if the type T is the builtin integer fitting a single word.
+template <typename T>
+inline constexpr bool is_word_operand_v = std::is_integral_v<T> && sizeof(T) <= sizeof(uint64_t);
+
+/// Computes x + y for the single word y.
+template <unsigned N>
+inline constexpr uint<N> add_1(const uint<N>& x, uint64_t y) noexcept
+{
+    uint<N> r;
+    unsigned long long carry = 0; // NOLINT(google-runtime-int)
+    r[0] = addc(x[0], y, &carry);
+    for (size_t i = 1; i < uint<N>::num_words; ++i)
+        r[i] = addc(x[i], 0, &carry);
+    return r;
+}
+
+/// Computes x - y for the single word y.
+template <unsigned N>
+inline constexpr uint<N> sub_1(const uint<N>& x, uint64_t y) noexcept
+{
+    uint<N> r;
+    unsigned long long borrow = 0; // NOLINT(google-runtime-int)
+    r[0] = subc(x[0], y, &borrow);
+    for (size_t i = 1; i < uint<N>::num_words; ++i)
+        r[i] = subc(x[i], 0, &borrow);
+    return r;
+}
+
+/// Computes x * y truncated to N bits for the single word y.
+/// This is a single row of the multiplication.
+template <unsigned N>
+inline constexpr uint<N> mul_1(const uint<N>& x, uint64_t y) noexcept
+{
+    uint<N> r;
+    uint64_t k = 0;
+    for (size_t i = 0; i < uint<N>::num_words; ++i)
+    {
+        const auto p = umul(x[i], y) + k;
+        r[i] = p[0];
+        k = p[1];
+    }
+    return r;
+}
+
+namespace internal
+{
+#if INTX_HAS_HW_DIV_2BY1
+/// Divides the 128-bit u by d with the div instruction. The quotient must fit 64 bits.
+inline div_result<uint64_t> udivrem_2by1_hw(uint128 u, uint64_t d) noexcept
+{
+    INTX_REQUIRE(u[1] < d);
+    uint64_t q{};
+    uint64_t r{};
+    asm("divq %[d]" : "=a"(q), "=d"(r) : "a"(u[0]), "d"(u[1]), [d] "rm"(d));
+    return {q, r};
+}
+
+/// Divides the lowest n words of x by d with the hardware division of each word.
+template <unsigned N>
+inline div_result<uint<N>, uint64_t> divrem_1_hw(const uint<N>& x, size_t n, uint64_t d) noexcept
+{
+    INTX_REQUIRE(d != 0);
+
+    uint<N> q;
+    uint64_t rem = 0;
+    for (size_t i = n; i-- > 0;)
+        std::tie(q[i], rem) = udivrem_2by1_hw({x[i], rem}, d);
+    return {q, rem};
+}
+#endif
+
+/// Divides the lowest n words of x by d.
+/// The numerator words are normalized on the fly and divided by the normalized divisor
+/// with its reciprocal, starting from the highest word.
+template <unsigned N>
+inline div_result<uint<N>, uint64_t> divrem_1_reciprocal(
+    const uint<N>& x, size_t n, uint64_t d) noexcept
+{
+    INTX_REQUIRE(d != 0);
+
+    const auto s = clz_nonzero(d);
+    const auto dn = d << s;
+    const auto reciprocal = reciprocal_2by1(dn);
+
+    uint<N> q;
+    uint64_t rem = n != 0 ? (x[n - 1] >> (63 - s)) >> 1 : 0;
+    for (size_t i = n; i-- > 0;)
+    {
+        const auto lo = i != 0 ? (x[i - 1] >> (63 - s)) >> 1 : 0;
+        std::tie(q[i], rem) = udivrem_2by1({(x[i] << s) | lo, rem}, dn, reciprocal);
+    }
+    return {q, rem >> s};
+}
+}  // namespace internal
+
+/// Divides x by the single word d.
+///
+/// The numerator shorter than INTX_DIVREM_1_RECIPROCAL_THRESHOLD words is divided with
+/// the hardware division if available. Otherwise the reciprocal of the divisor is used.
+template <unsigned N>
+inline div_result<uint<N>, uint64_t> divrem_1(const uint<N>& x, uint64_t d) noexcept
+{
+    size_t n = uint<N>::num_words;
+    while (n > 0 && x[n - 1] == 0)
+        --n;
+
+#if INTX_HAS_HW_DIV_2BY1
+    if (n < INTX_DIVREM_1_RECIPROCAL_THRESHOLD)
+        return internal::divrem_1_hw(x, n, d);
+#endif
+    return internal::divrem_1_reciprocal(x, n, d);
+}
+
+/// @}
+
+
 // Support for type conversions for binary operators.
 
 template <unsigned N, typename T,
-    typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
+    typename = typename std::enable_if<is_foreign_operand_v<T, N>>::type>
 inline constexpr uint<N> operator+(const uint<N>& x, const T& y) noexcept
 {
-    return x + uint<N>(y);
+    if constexpr (is_word_operand_v<T>)
+        return add_1(x, static_cast<uint64_t>(y));
+    else
+        return x + uint<N>(y);
 }
 
 template <unsigned N, typename T,
-    typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
+    typename = typename std::enable_if<is_foreign_operand_v<T, N>>::type>
 inline constexpr uint<N> operator+(const T& x, const uint<N>& y) noexcept
 {
-    return uint<N>(x) + y;
+    if constexpr (is_word_operand_v<T>)
+        return add_1(y, static_cast<uint64_t>(x));
+    else
+        return uint<N>(x) + y;
 }
 
 template <unsigned N, typename T,
-    typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
+    typename = typename std::enable_if<is_foreign_operand_v<T, N>>::type>
 inline constexpr uint<N> operator-(const uint<N>& x, const T& y) noexcept
 {
-    return x - uint<N>(y);
+    if constexpr (is_word_operand_v<T>)
+        return sub_1(x, static_cast<uint64_t>(y));
+    else
+        return x - uint<N>(y);
 }
 
 template <unsigned N, typename T,
-    typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
+    typename = typename std::enable_if<is_foreign_operand_v<T, N>>::type>
 inline constexpr uint<N> operator-(const T& x, const uint<N>& y) noexcept
 {
     return uint<N>(x) - y;
 }
 
 template <unsigned N, typename T,
-    typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
+    typename = typename std::enable_if<is_foreign_operand_v<T, N>>::type>
 inline constexpr uint<N> operator*(const uint<N>& x, const T& y) noexcept
 {
-    return x * uint<N>(y);
+    if constexpr (is_word_operand_v<T>)
+        return mul_1(x, static_cast<uint64_t>(y));
+    else
+        return x * uint<N>(y);
 }
 
 template <unsigned N, typename T,
-    typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
+    typename = typename std::enable_if<is_foreign_operand_v<T, N>>::type>
 inline constexpr uint<N> operator*(const T& x, const uint<N>& y) noexcept
 {
-    return uint<N>(x) * y;
+    if constexpr (is_word_operand_v<T>)
+        return mul_1(y, static_cast<uint64_t>(x));
+    else
+        return uint<N>(x) * y;
 }
 
 template <unsigned N, typename T,
-    typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
+    typename = typename std::enable_if<is_foreign_operand_v<T, N>>::type>
 inline constexpr uint<N> operator/(const uint<N>& x, const T& y) noexcept
 {
-    return x / uint<N>(y);
+    if constexpr (is_word_operand_v<T>)
+        return divrem_1(x, static_cast<uint64_t>(y)).quot;
+    else
+        return x / uint<N>(y);
 }
 
 template <unsigned N, typename T,
-    typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
+    typename = typename std::enable_if<is_foreign_operand_v<T, N>>::type>
 inline constexpr uint<N> operator/(const T& x, const uint<N>& y) noexcept
 {
     return uint<N>(x) / y;
 }
 
 template <unsigned N, typename T,
-    typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
+    typename = typename std::enable_if<is_foreign_operand_v<T, N>>::type>
 inline constexpr uint<N> operator%(const uint<N>& x, const T& y) noexcept
 {
-    return x % uint<N>(y);
+    if constexpr (is_word_operand_v<T>)
+        return divrem_1(x, static_cast<uint64_t>(y)).rem;
+    else
+        return x % uint<N>(y);
 }
 
 template <unsigned N, typename T,
-    typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
+    typename = typename std::enable_if<is_foreign_operand_v<T, N>>::type>
 inline constexpr uint<N> operator%(const T& x, const uint<N>& y) noexcept
 {
     return uint<N>(x) % y;
 }
 
 template <unsigned N, typename T,
-    typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
+    typename = typename std::enable_if<is_foreign_operand_v<T, N>>::type>
 inline constexpr uint<N> operator|(const uint<N>& x, const T& y) noexcept
 {
     return x | uint<N>(y);
 }
 
 template <unsigned N, typename T,
-    typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
+    typename = typename std::enable_if<is_foreign_operand_v<T, N>>::type>
 inline constexpr uint<N> operator|(const T& x, const uint<N>& y) noexcept
 {
     return uint<N>(x) | y;
 }
 
 template <unsigned N, typename T,
-    typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
+    typename = typename std::enable_if<is_foreign_operand_v<T, N>>::type>
 inline constexpr uint<N> operator&(const uint<N>& x, const T& y) noexcept
 {
     return x & uint<N>(y);
 }
 
 template <unsigned N, typename T,
-    typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
+    typename = typename std::enable_if<is_foreign_operand_v<T, N>>::type>
 inline constexpr uint<N> operator&(const T& x, const uint<N>& y) noexcept
 {
     return uint<N>(x) & y;
 }
 
 template <unsigned N, typename T,
-    typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
+    typename = typename std::enable_if<is_foreign_operand_v<T, N>>::type>
 inline constexpr uint<N> operator^(const uint<N>& x, const T& y) noexcept
 {
     return x ^ uint<N>(y);
 }
 
 template <unsigned N, typename T,
-    typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
+    typename = typename std::enable_if<is_foreign_operand_v<T, N>>::type>
 inline constexpr uint<N> operator^(const T& x, const uint<N>& y) noexcept
 {
     return uint<N>(x) ^ y;
@@ -1965,35 +2704,48 @@ template <unsigned N, typename T,
     typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
 inline constexpr uint<N>& operator|=(uint<N>& x, const T& y) noexcept
 {
-    return x = x | y;
+    const uint<N>& z = y;  // Not a copy if y is uint<N>.
+    for (size_t i = 0; i < uint<N>::num_words; ++i)
+        x[i] |= z[i];
+    return x;
 }
 
 template <unsigned N, typename T,
     typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
 inline constexpr uint<N>& operator&=(uint<N>& x, const T& y) noexcept
 {
-    return x = x & y;
+    const uint<N>& z = y;  // Not a copy if y is uint<N>.
+    for (size_t i = 0; i < uint<N>::num_words; ++i)
+        x[i] &= z[i];
+    return x;
 }
 
 template <unsigned N, typename T,
     typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
 inline constexpr uint<N>& operator^=(uint<N>& x, const T& y) noexcept
 {
-    return x = x ^ y;
+    const uint<N>& z = y;  // Not a copy if y is uint<N>.
+    for (size_t i = 0; i < uint<N>::num_words; ++i)
+        x[i] ^= z[i];
+    return x;
 }
 
 template <unsigned N, typename T,
     typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
 inline constexpr uint<N>& operator<<=(uint<N>& x, const T& y) noexcept
 {
-    return x = x << y;
+    if (y < T{sizeof(x) * 8})
+        return x <<= static_cast<uint64_t>(y);
+    return x = 0;
 }
 
 template <unsigned N, typename T,
     typename = typename std::enable_if<std::is_convertible<T, uint<N>>::value>::type>
 inline constexpr uint<N>& operator>>=(uint<N>& x, const T& y) noexcept
 {
-    return x = x >> y;
+    if (y < T{sizeof(x) * 8})
+        return x >>= static_cast<uint64_t>(y);
+    return x = 0;
 }
 
 
@@ -2031,12 +2783,45 @@ inline uint256 addmod(const uint256& x, const uint256& y, const uint256& mod) no
     const auto s = addc(x, y, &carry);
     uint<256 + 64> n = s;
     n[4] = carry;
-    return udivrem(n, mod).rem;
+    return umod(n, mod);
 }
 
 inline uint256 mulmod(const uint256& x, const uint256& y, const uint256& mod) noexcept
 {
-    return udivrem(umul(x, y), mod).rem;
+    return umod(umul(x, y), mod);
+}
+
+/// Computes r[k] = x[k] * y[k] mod mod[k] for K independent operand sets.
+///
+/// The K products are computed with the word multiplications interleaved so their carry
+/// chains overlap. The divisions are data dependent and are done one after another.
+template <size_t K>
+inline void mulmod(uint256 (&r)[K], const uint256 (&x)[K], const uint256 (&y)[K],
+    const uint256 (&mod)[K]) noexcept
+{
+    constexpr auto num_words = uint256::num_words;
+
+    uint512 p[K]{};
+    for (size_t j = 0; j < num_words; ++j)
+    {
+        uint64_t c[K]{};
+        for (size_t i = 0; i < num_words; ++i)
+        {
+            for (size_t k = 0; k < K; ++k)
+            {
+                unsigned long long carry = 0; // NOLINT(google-runtime-int)
+                const auto a = addc(p[k][i + j], c[k], &carry);
+                const auto t = umul(x[k][i], y[k][j]) + uint128{a, carry};
+                p[k][i + j] = t[0];
+                c[k] = t[1];
+            }
+        }
+        for (size_t k = 0; k < K; ++k)
+            p[k][j + num_words] = c[k];
+    }
+
+    for (size_t k = 0; k < K; ++k)
+        r[k] = umod(p[k], mod[k]);
 }
 
 
@@ -2087,6 +2872,72 @@ inline constexpr T to_big_endian(const T& x) noexcept
     }
 }
 
+namespace internal
+{
+/// Loads the uint from the little-endian bytes with the word loads.
+/// On big-endian hosts these are the byte-reversed loads and the loop vectorizes
+/// to the byte permutations.
+template <typename T>
+inline T load_le_words(const uint8_t* src) noexcept
+{
+    T x;
+    for (size_t i = 0; i < T::num_words; ++i)
+    {
+        uint64_t w;
+        std::memcpy(&w, &src[i * sizeof(w)], sizeof(w));
+        x[i] = to_little_endian(w);
+    }
+    return x;
+}
+
+/// Loads the uint from the big-endian bytes with the word loads in the reversed order.
+/// On big-endian hosts these are the native loads.
+template <typename T>
+inline T load_be_words(const uint8_t* src) noexcept
+{
+    T x;
+    for (size_t i = 0; i < T::num_words; ++i)
+    {
+        uint64_t w;
+        std::memcpy(&w, &src[i * sizeof(w)], sizeof(w));
+        x[T::num_words - 1 - i] = to_big_endian(w);
+    }
+    return x;
+}
+
+/// Stores the uint in the little-endian bytes with the word stores.
+template <typename T>
+inline void store_le_words(uint8_t* dst, const T& x) noexcept
+{
+    for (size_t i = 0; i < T::num_words; ++i)
+    {
+        const auto w = to_little_endian(x[i]);
+        std::memcpy(&dst[i * sizeof(w)], &w, sizeof(w));
+    }
+}
+
+/// Stores the uint in the big-endian bytes with the word stores in the reversed order.
+template <typename T>
+inline void store_be_words(uint8_t* dst, const T& x) noexcept
+{
+    for (size_t i = 0; i < T::num_words; ++i)
+    {
+        const auto w = to_big_endian(x[T::num_words - 1 - i]);
+        std::memcpy(&dst[i * sizeof(w)], &w, sizeof(w));
+    }
+}
+
+/// The intx uints are loaded and stored word by word, the built-in types (including
+/// builtin_uint128) with the conversion of the whole value. The word conversions are the native
+/// loads/stores on big-endian hosts and are also faster than the conversion of the whole value
+/// on little-endian hosts (no copy of the whole value in the stack).
+template <typename T>
+constexpr bool use_word_conversions = false;
+
+template <unsigned N>
+constexpr bool use_word_conversions<uint<N>> = true;
+}  // namespace internal
+
 namespace le  // Conversions to/from LE bytes.
 {
 template <typename T, unsigned M>
@@ -2094,6 +2945,8 @@ inline T load(const uint8_t (&src)[M]) noexcept
 {
     static_assert(
         M == sizeof(T), "the size of source bytes must match the size of the destination uint");
+    if constexpr (internal::use_word_conversions<T>)
+        return internal::load_le_words<T>(src);
     T x;
     std::memcpy(&x, src, sizeof(x));
     return to_little_endian(x);
@@ -2102,6 +2955,8 @@ inline T load(const uint8_t (&src)[M]) noexcept
 template <typename T>
 inline void store(uint8_t (&dst)[sizeof(T)], const T& x) noexcept
 {
+    if constexpr (internal::use_word_conversions<T>)
+        return internal::store_le_words(dst, x);
     const auto d = to_little_endian(x);
     std::memcpy(dst, &d, sizeof(d));
 }
@@ -2111,6 +2966,8 @@ namespace unsafe
 template <typename T>
 inline T load(const uint8_t* src) noexcept
 {
+    if constexpr (internal::use_word_conversions<T>)
+        return internal::load_le_words<T>(src);
     T x;
     std::memcpy(&x, src, sizeof(x));
     return to_little_endian(x);
@@ -2119,6 +2976,8 @@ inline T load(const uint8_t* src) noexcept
 template <typename T>
 inline void store(uint8_t* dst, const T& x) noexcept
 {
+    if constexpr (internal::use_word_conversions<T>)
+        return internal::store_le_words(dst, x);
     const auto d = to_little_endian(x);
     std::memcpy(dst, &d, sizeof(d));
 }
@@ -2135,6 +2994,8 @@ inline T load(const uint8_t (&src)[M]) noexcept
 {
     static_assert(M <= sizeof(T),
         "the size of source bytes must not exceed the size of the destination uint");
+    if constexpr (M == sizeof(T) && internal::use_word_conversions<T>)
+        return internal::load_be_words<T>(src);
     T x{};
     std::memcpy(&as_bytes(x)[sizeof(T) - M], src, M);
     x = to_big_endian(x);
@@ -2151,6 +3012,8 @@ inline IntT load(const T& t) noexcept
 template <typename T>
 inline void store(uint8_t (&dst)[sizeof(T)], const T& x) noexcept
 {
+    if constexpr (internal::use_word_conversions<T>)
+        return internal::store_be_words(dst, x);
     const auto d = to_big_endian(x);
     std::memcpy(dst, &d, sizeof(d));
 }
@@ -2192,6 +3055,8 @@ namespace unsafe
 template <typename IntT>
 inline IntT load(const uint8_t* src) noexcept
 {
+    if constexpr (internal::use_word_conversions<IntT>)
+        return internal::load_be_words<IntT>(src);
     IntT x;
     std::memcpy(&x, src, sizeof(x));
     x = to_big_endian(x);
@@ -2203,6 +3068,8 @@ inline IntT load(const uint8_t* src) noexcept
 template <typename T>
 inline void store(uint8_t* dst, const T& x) noexcept
 {
+    if constexpr (internal::use_word_conversions<T>)
+        return internal::store_be_words(dst, x);
     const auto d = to_big_endian(x);
     std::memcpy(dst, &d, sizeof(d));
 }
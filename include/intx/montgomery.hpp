@@ -0,0 +1,253 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+/// @file
+/// Montgomery modular arithmetic for odd moduli.
+
+#pragma once
+
+#include <intx/intx.hpp>
+#include <utility>
+
+namespace intx
+{
+namespace internal
+{
+/// Computes a * b + c + d. The result always fits 128 bits.
+inline constexpr uint128 umul_acc(uint64_t a, uint64_t b, uint64_t c, uint64_t d) noexcept
+{
+    unsigned long long carry = 0;  // NOLINT(google-runtime-int)
+    const auto s = addc(c, d, &carry);
+    return umul(a, b) + uint128{s, carry};
+}
+}  // namespace internal
+
+/// The Montgomery arithmetic context for an odd modulus m of at most N bits.
+///
+/// The values in the Montgomery form are x * R mod m where R = 2^N.
+/// The product of two values in the Montgomery form is computed by mul()
+/// with the interleaved multiplication and reduction (CIOS) without any division.
+template <unsigned N>
+class montgomery
+{
+    static constexpr auto num_words = uint<N>::num_words;
+
+    uint<N> mod_;
+    uint64_t mod_inv_ = 0;  ///< -m^-1 mod 2^64.
+    uint<N> r2_;            ///< R^2 mod m.
+
+public:
+    /// Creates the context for the odd modulus.
+    constexpr explicit montgomery(const uint<N>& mod) noexcept : mod_{mod}
+    {
+        // Newton's iteration for the inverse of m[0] doubles the number of correct bits
+        // and m[0] is its own inverse modulo 2^3.
+        uint64_t inv = mod[0];
+        for (int i = 0; i < 5; ++i)
+            inv *= 2 - mod[0] * inv;
+        mod_inv_ = ~inv + 1;
+
+        // R^2 mod m = (R^2 - 1) mod m + 1, unless it wraps around.
+        r2_ = umod(~uint<2 * N>{0}, mod) + 1;
+        if (r2_ == mod)
+            r2_ = 0;
+    }
+
+    [[nodiscard]] constexpr const uint<N>& mod() const noexcept { return mod_; }
+
+    /// Checks if the modulus is less than R/4 so that values up to 3m fit N bits.
+    /// This enables the lazy reduction with almost_mul().
+    [[nodiscard]] constexpr bool has_spare_bits() const noexcept
+    {
+        return mod_[num_words - 1] >> 62 == 0;
+    }
+
+    /// Computes x * y / R mod m without the final reduction.
+    ///
+    /// If x * y < m * R the result is less than 2m and congruent to x * y / R.
+    /// The result fits N bits if m < R/2.
+    [[nodiscard]] constexpr uint<N> almost_mul(const uint<N>& x, const uint<N>& y) const noexcept
+    {
+        return redc_mul(x, y).value;
+    }
+
+    /// Computes x * y / R mod m. Requires x * y < m * R, e.g. both x and y less than m.
+    /// The result is less than m.
+    [[nodiscard]] constexpr uint<N> mul(const uint<N>& x, const uint<N>& y) const noexcept
+    {
+        const auto [t, t_hi] = redc_mul(x, y);
+        unsigned long long borrow = 0;  // NOLINT(google-runtime-int)
+        const auto d = subc(t, mod_, &borrow);
+        return (t_hi || borrow == 0) ? d : t;
+    }
+
+    /// Computes x + y mod m for x and y less than m.
+    [[nodiscard]] constexpr uint<N> add(const uint<N>& x, const uint<N>& y) const noexcept
+    {
+        unsigned long long carry = 0;  // NOLINT(google-runtime-int)
+        const auto s = addc(x, y, &carry);
+        unsigned long long borrow = 0;  // NOLINT(google-runtime-int)
+        const auto d = subc(s, mod_, &borrow);
+        return (carry != 0 || borrow == 0) ? d : s;
+    }
+
+    /// Computes x - y mod m for x and y less than m.
+    [[nodiscard]] constexpr uint<N> sub(const uint<N>& x, const uint<N>& y) const noexcept
+    {
+        unsigned long long borrow = 0;  // NOLINT(google-runtime-int)
+        const auto d = subc(x, y, &borrow);
+        return borrow != 0 ? d + mod_ : d;
+    }
+
+    /// Converts x to the Montgomery form. The x does not have to be reduced modulo m.
+    [[nodiscard]] constexpr uint<N> to_mont(const uint<N>& x) const noexcept
+    {
+        return mul(x, r2_);
+    }
+
+    /// Converts x from the Montgomery form. The result is less than m.
+    [[nodiscard]] constexpr uint<N> from_mont(const uint<N>& x) const noexcept
+    {
+        return mul(x, uint<N>{1});
+    }
+
+    /// The Montgomery form of 1.
+    [[nodiscard]] constexpr uint<N> one() const noexcept { return to_mont(uint<N>{1}); }
+
+    /// Computes x^e for x in the Montgomery form. The result is in the Montgomery form.
+    [[nodiscard]] constexpr uint<N> pow(const uint<N>& x, const uint<N>& e) const noexcept
+    {
+        uint<N> r[1];
+        pow(r, {x}, {e});
+        return r[0];
+    }
+
+    /// Computes the multiplicative inverse of x in the Montgomery form by the Fermat's little
+    /// theorem. The modulus must be prime. The inverse of 0 is 0.
+    [[nodiscard]] constexpr uint<N> inv(const uint<N>& x) const noexcept
+    {
+        return pow(x, mod_ - 2);
+    }
+
+    /// Computes r[k] = x[k] * y[k] / R mod m for K independent operand pairs.
+    ///
+    /// The K Montgomery multiplications are interleaved row by row so the out-of-order core
+    /// can overlap their carry chains. The r may alias x or y.
+    template <size_t K>
+    constexpr void mul(
+        uint<N> (&r)[K], const uint<N> (&x)[K], const uint<N> (&y)[K]) const noexcept
+    {
+        mul_multi(r, x, y, std::make_index_sequence<K>{});
+    }
+
+    /// Computes r[k] = x[k]^e[k] for K independent bases and exponents in the Montgomery form.
+    ///
+    /// Uses the fixed 4-bit window exponentiation with the multiplications of all K chains
+    /// interleaved by the multi-operand mul(). The r may alias x.
+    template <size_t K>
+    constexpr void pow(
+        uint<N> (&r)[K], const uint<N> (&x)[K], const uint<N> (&e)[K]) const noexcept
+    {
+        constexpr unsigned window_bits = 4;
+        constexpr size_t table_size = size_t{1} << window_bits;
+
+        unsigned num_bits = 0;
+        for (size_t k = 0; k < K; ++k)
+            num_bits = std::max(num_bits, N - clz(e[k]));
+
+        uint<N> table[table_size][K]{};
+        for (size_t k = 0; k < K; ++k)
+        {
+            table[0][k] = one();
+            table[1][k] = x[k];
+        }
+        for (size_t i = 2; i < table_size; ++i)
+            mul(table[i], table[i - 1], table[1]);
+
+        uint<N> acc[K];
+        for (size_t k = 0; k < K; ++k)
+            acc[k] = table[0][k];
+
+        for (auto w = (num_bits + window_bits - 1) / window_bits; w-- != 0;)
+        {
+            for (unsigned i = 0; i < window_bits; ++i)
+                mul(acc, acc, acc);
+
+            const auto bit_index = w * window_bits;
+            uint<N> f[K];
+            for (size_t k = 0; k < K; ++k)
+                f[k] = table[(e[k][bit_index / 64] >> (bit_index % 64)) & (table_size - 1)][k];
+            mul(acc, acc, f);
+        }
+
+        for (size_t k = 0; k < K; ++k)
+            r[k] = acc[k];
+    }
+
+private:
+    template <size_t K, size_t... I>
+    constexpr void mul_multi(uint<N> (&r)[K], const uint<N> (&x)[K], const uint<N> (&y)[K],
+        std::index_sequence<I...>) const noexcept
+    {
+        uint<N> t[K]{};
+        uint64_t t_hi[K]{};
+        for (size_t i = 0; i < num_words; ++i)
+            (redc_row(t[I], t_hi[I], x[I], y[I][i]), ...);
+
+        for (size_t k = 0; k < K; ++k)
+        {
+            unsigned long long borrow = 0;  // NOLINT(google-runtime-int)
+            const auto d = subc(t[k], mod_, &borrow);
+            r[k] = (t_hi[k] != 0 || borrow == 0) ? d : t[k];
+        }
+    }
+
+    /// The single iteration of the CIOS Montgomery multiplication:
+    /// t + t_hi * R = (t + t_hi * R + x * b + q * m) / 2^64.
+    constexpr void redc_row(
+        uint<N>& t, uint64_t& t_hi, const uint<N>& x, uint64_t b) const noexcept
+    {
+        uint64_t k = 0;
+        for (size_t j = 0; j < num_words; ++j)
+        {
+            const auto p = internal::umul_acc(x[j], b, t[j], k);
+            t[j] = p[0];
+            k = p[1];
+        }
+        unsigned long long carry = 0;  // NOLINT(google-runtime-int)
+        t_hi = addc(t_hi, k, &carry);
+        const auto t_top = carry;
+
+        const auto q = t[0] * mod_inv_;
+        k = internal::umul_acc(q, mod_[0], t[0], 0)[1];
+        for (size_t j = 1; j < num_words; ++j)
+        {
+            const auto p = internal::umul_acc(q, mod_[j], t[j], k);
+            t[j - 1] = p[0];
+            k = p[1];
+        }
+        carry = 0;
+        t[num_words - 1] = addc(t_hi, k, &carry);
+        t_hi = t_top + carry;
+    }
+
+    struct redc_result
+    {
+        uint<N> value;
+        bool carry;
+    };
+
+    /// The CIOS Montgomery multiplication: (x * y + q * m) / R.
+    /// The value is the low N bits of the result, the carry is the (N+1)-th bit.
+    [[nodiscard]] constexpr redc_result redc_mul(
+        const uint<N>& x, const uint<N>& y) const noexcept
+    {
+        uint<N> t;
+        uint64_t t_hi = 0;
+        for (size_t i = 0; i < num_words; ++i)
+            redc_row(t, t_hi, x, y[i]);
+        return {t, t_hi != 0};
+    }
+};
+}  // namespace intx
@@ -0,0 +1,143 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+/// @file
+/// The hot kernels compiled for several x86-64 ISA levels with the run-time dispatch.
+///
+/// Opt-in: define INTX_MULTIVERSIONING=1 for all files of the program (the CMake option
+/// INTX_MULTIVERSIONING does this for the intx target), otherwise the inline kernels have
+/// different definitions in different files. Then each kernel is compiled with the target_clones
+/// attribute for the baseline x86-64 and the x86-64-v2, v3 (AVX2, BMI2 mulx/shlx) and v4
+/// (AVX-512) levels and the version for the host CPU is selected by the ifunc resolver
+/// when the program is loaded. The kernels are flattened: the intx code they call is inlined
+/// and compiled for the level too. This allows the binaries built for the baseline x86-64
+/// to use the newer instructions on the hosts supporting them.
+///
+/// The calls go through the ifunc so the kernels are not inlined. Use them for the operations
+/// costly enough (wide multiplication, division) or for the arrays (the bulk loads/stores).
+/// Requires GCC 12+ on x86-64 ELF targets, otherwise the kernels are the plain intx ones.
+
+#pragma once
+
+#include <intx/intx.hpp>
+
+#ifndef INTX_MULTIVERSIONING
+    #define INTX_MULTIVERSIONING 0
+#endif
+
+#if INTX_MULTIVERSIONING && defined(__x86_64__) && defined(__ELF__) && !defined(__clang__) && \
+    defined(__GNUC__) && __GNUC__ >= 12
+    #define INTX_HAS_TARGET_CLONES 1
+    #define INTX_MV_KERNEL                                                                  \
+        __attribute__((target_clones("default", "arch=x86-64-v2", "arch=x86-64-v3",        \
+            "arch=x86-64-v4"), flatten))
+#else
+    #define INTX_HAS_TARGET_CLONES 0
+    #define INTX_MV_KERNEL
+#endif
+
+namespace intx::mv
+{
+/// Returns the name of the ISA level of the kernel versions selected for the host CPU:
+/// "x86-64-v4", "x86-64-v3", "x86-64-v2" or "default" (also if not multiversioned).
+inline const char* selected_isa() noexcept
+{
+#if INTX_HAS_TARGET_CLONES
+    // The same order of priority as in the ifunc resolvers.
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("x86-64-v4"))
+        return "x86-64-v4";
+    if (__builtin_cpu_supports("x86-64-v3"))
+        return "x86-64-v3";
+    if (__builtin_cpu_supports("x86-64-v2"))
+        return "x86-64-v2";
+#endif
+    return "default";
+}
+
+template <unsigned N>
+INTX_MV_KERNEL inline uint<2 * N> umul(const uint<N>& x, const uint<N>& y) noexcept
+{
+    return intx::umul(x, y);
+}
+
+template <unsigned N>
+INTX_MV_KERNEL inline uint<N> mul(const uint<N>& x, const uint<N>& y) noexcept
+{
+    return x * y;
+}
+
+/// The division. The Knuth's division (with the submul() kernel) for the divisors
+/// of more than 2 words.
+template <unsigned N>
+INTX_MV_KERNEL inline div_result<uint<N>> udivrem(const uint<N>& x, const uint<N>& y) noexcept
+{
+    return intx::udivrem(x, y);
+}
+
+template <unsigned N>
+INTX_MV_KERNEL inline uint<N> shl(const uint<N>& x, uint64_t shift) noexcept
+{
+    return x << shift;
+}
+
+template <unsigned N>
+INTX_MV_KERNEL inline uint<N> shr(const uint<N>& x, uint64_t shift) noexcept
+{
+    return x >> shift;
+}
+
+/// The bitwise operations, vectorized for the large N.
+/// @{
+template <unsigned N>
+INTX_MV_KERNEL inline uint<N> bit_and(const uint<N>& x, const uint<N>& y) noexcept
+{
+    return x & y;
+}
+
+template <unsigned N>
+INTX_MV_KERNEL inline uint<N> bit_or(const uint<N>& x, const uint<N>& y) noexcept
+{
+    return x | y;
+}
+
+template <unsigned N>
+INTX_MV_KERNEL inline uint<N> bit_xor(const uint<N>& x, const uint<N>& y) noexcept
+{
+    return x ^ y;
+}
+/// @}
+
+/// The bulk loads/stores of n values from/to the bytes in big-endian (be_) or
+/// little-endian (le_) order.
+/// @{
+template <unsigned N>
+INTX_MV_KERNEL inline void be_load_n(uint<N>* r, const uint8_t* src, size_t n) noexcept
+{
+    for (size_t i = 0; i < n; ++i)
+        r[i] = be::unsafe::load<uint<N>>(&src[i * sizeof(uint<N>)]);
+}
+
+template <unsigned N>
+INTX_MV_KERNEL inline void be_store_n(uint8_t* dst, const uint<N>* x, size_t n) noexcept
+{
+    for (size_t i = 0; i < n; ++i)
+        be::unsafe::store(&dst[i * sizeof(uint<N>)], x[i]);
+}
+
+template <unsigned N>
+INTX_MV_KERNEL inline void le_load_n(uint<N>* r, const uint8_t* src, size_t n) noexcept
+{
+    for (size_t i = 0; i < n; ++i)
+        r[i] = le::unsafe::load<uint<N>>(&src[i * sizeof(uint<N>)]);
+}
+
+template <unsigned N>
+INTX_MV_KERNEL inline void le_store_n(uint8_t* dst, const uint<N>* x, size_t n) noexcept
+{
+    for (size_t i = 0; i < n; ++i)
+        le::unsafe::store(&dst[i * sizeof(uint<N>)], x[i]);
+}
+/// @}
+}  // namespace intx::mv
@@ -0,0 +1,154 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+/// @file
+/// Packed storage of unsigned integers of any number of bytes.
+
+#pragma once
+
+#include <intx/intx.hpp>
+#include <functional>
+
+namespace intx
+{
+/// The packed storage of an unsigned integer of the given number of bytes.
+///
+/// Unlike uint<N> the size is not rounded up to the multiple of 64-bit words, e.g.
+/// the 160-bit Ethereum address takes 20 bytes instead of 24 bytes of uint192.
+/// The value is stored in the .bytes array in the big-endian order, so the type can be used
+/// directly with be::load(), be::store() and be::trunc(). The arithmetic is done after
+/// the lossless widening to uint<N>.
+template <size_t Bytes>
+struct uint_packed
+{
+    static_assert(Bytes > 0, "the size must not be zero");
+
+    static constexpr size_t num_bytes = Bytes;
+    static constexpr auto num_bits = static_cast<unsigned>(Bytes * 8);
+
+    /// The number of bits of the smallest uint<N> fitting the packed value.
+    static constexpr auto widened_bits = std::max((num_bits + 63) / 64 * 64, 128u);
+
+    uint8_t bytes[Bytes]{};
+
+    constexpr uint_packed() noexcept = default;
+
+    /// Packs the value of uint<N>. The bytes not fitting the packed type are truncated.
+    template <unsigned N>
+    explicit uint_packed(const uint<N>& x) noexcept
+    {
+        constexpr auto n = std::min(Bytes, size_t{N / 8});
+        const auto d = to_big_endian(x);
+        std::memcpy(&bytes[Bytes - n], &as_bytes(d)[sizeof(d) - n], n);
+    }
+
+    /// The lossless conversion to any uint<N> not smaller than the packed value.
+    template <unsigned N, typename = std::enable_if_t<(N >= num_bits)>>
+    operator uint<N>() const noexcept  // NOLINT(hicpp-explicit-conversions)
+    {
+        return be::load<uint<N>>(bytes);
+    }
+
+    /// Converts to the smallest uint<N> fitting the packed value.
+    [[nodiscard]] uint<widened_bits> widen() const noexcept
+    {
+        return be::load<uint<widened_bits>>(bytes);
+    }
+};
+
+namespace internal
+{
+/// Loads the chunk of up to 8 bytes of the packed value at the given offset
+/// as the big-endian number, so the numeric order of chunks matches the order of values.
+template <size_t Size>
+inline uint64_t load_packed_chunk(const uint8_t* p) noexcept
+{
+    static_assert(Size <= sizeof(uint64_t));
+    uint64_t x = 0;
+    std::memcpy(&x, p, Size);
+    return to_big_endian(x);
+}
+
+template <size_t Bytes, size_t Offset = 0>
+inline bool packed_less(const uint8_t* x, const uint8_t* y) noexcept
+{
+    constexpr auto size = std::min(Bytes - Offset, sizeof(uint64_t));
+    const auto a = load_packed_chunk<size>(&x[Offset]);
+    const auto b = load_packed_chunk<size>(&y[Offset]);
+    if constexpr (Offset + size == Bytes)
+        return a < b;
+    else
+    {
+        if (a != b)
+            return a < b;
+        return packed_less<Bytes, Offset + size>(x, y);
+    }
+}
+
+/// Mixes the chunks of up to 8 bytes of the packed value into the hash h.
+template <size_t Bytes, size_t Offset = 0>
+inline uint64_t packed_hash(const uint8_t* x, uint64_t h) noexcept
+{
+    constexpr auto size = std::min(Bytes - Offset, sizeof(uint64_t));
+    uint64_t chunk = 0;
+    std::memcpy(&chunk, &x[Offset], size);
+    h = (h ^ chunk) * 0x9e3779b97f4a7c15;
+    h ^= h >> 32;
+    if constexpr (Offset + size == Bytes)
+        return h;
+    else
+        return packed_hash<Bytes, Offset + size>(x, h);
+}
+}  // namespace internal
+
+template <size_t Bytes>
+inline bool operator==(const uint_packed<Bytes>& x, const uint_packed<Bytes>& y) noexcept
+{
+    return std::memcmp(x.bytes, y.bytes, Bytes) == 0;  // Inlined for the constant size.
+}
+
+template <size_t Bytes>
+inline bool operator!=(const uint_packed<Bytes>& x, const uint_packed<Bytes>& y) noexcept
+{
+    return !(x == y);
+}
+
+/// Compares the values by the big-endian chunks of 8 bytes from the most significant one.
+template <size_t Bytes>
+inline bool operator<(const uint_packed<Bytes>& x, const uint_packed<Bytes>& y) noexcept
+{
+    return internal::packed_less<Bytes>(x.bytes, y.bytes);
+}
+
+template <size_t Bytes>
+inline bool operator>(const uint_packed<Bytes>& x, const uint_packed<Bytes>& y) noexcept
+{
+    return y < x;
+}
+
+template <size_t Bytes>
+inline bool operator<=(const uint_packed<Bytes>& x, const uint_packed<Bytes>& y) noexcept
+{
+    return !(y < x);
+}
+
+template <size_t Bytes>
+inline bool operator>=(const uint_packed<Bytes>& x, const uint_packed<Bytes>& y) noexcept
+{
+    return !(x < y);
+}
+}  // namespace intx
+
+namespace std
+{
+/// Hashes the packed value by mixing its chunks of 8 bytes.
+template <size_t Bytes>
+struct hash<intx::uint_packed<Bytes>>
+{
+    size_t operator()(const intx::uint_packed<Bytes>& x) const noexcept
+    {
+        return static_cast<size_t>(intx::internal::packed_hash<Bytes>(x.bytes, Bytes));
+    }
+};
+}  // namespace std
@@ -0,0 +1,179 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+/// @file
+/// Polynomial evaluation modulo m.
+
+#pragma once
+
+#include <intx/montgomery.hpp>
+#include <thread>
+#include <vector>
+
+namespace intx
+{
+namespace internal
+{
+/// The Horner's scheme evaluation of the polynomial at K points at once.
+///
+/// The K accumulator chains are independent so their multiplications can overlap.
+/// The points are converted to the Montgomery form and the coefficients are reduced but
+/// not converted: the Montgomery product acc * xR / R = acc * x is already in the regular form.
+///
+/// With the lazy reduction (the modulus has spare bits) the final subtraction of
+/// the Montgomery product and the reduction of the sum are skipped:
+/// the product is less than 2m and the accumulator less than 3m for the whole evaluation.
+template <bool Lazy, size_t K, unsigned N>
+inline void horner_batch(const montgomery<N>& context, const uint<N>* coeffs, size_t num_coeffs,
+    const uint<N>* points, uint<N>* results) noexcept
+{
+    // Local copies, so the compiler knows the stores to the accumulators do not alias them.
+    const auto ctx = context;
+    uint<N> xs[K];
+    for (size_t k = 0; k < K; ++k)
+        xs[k] = ctx.to_mont(points[k]);
+
+    uint<N> acc[K]{};
+    for (size_t i = num_coeffs; i-- != 0;)
+    {
+        const auto& c = coeffs[i];
+        for (size_t k = 0; k < K; ++k)
+        {
+            if constexpr (Lazy)
+                acc[k] = ctx.almost_mul(acc[k], xs[k]) + c;
+            else
+                acc[k] = ctx.add(ctx.mul(acc[k], xs[k]), c);
+        }
+    }
+
+    for (size_t k = 0; k < K; ++k)
+    {
+        if constexpr (Lazy)
+        {
+            const auto& m = ctx.mod();
+            if (acc[k] >= m)
+                acc[k] -= m;
+            if (acc[k] >= m)
+                acc[k] -= m;
+        }
+        results[k] = acc[k];
+    }
+}
+
+template <size_t K, unsigned N>
+inline void horner_points(const montgomery<N>& ctx, const uint<N>* coeffs, size_t num_coeffs,
+    const uint<N>* points, uint<N>* results) noexcept
+{
+    if (ctx.has_spare_bits())
+        horner_batch<true, K>(ctx, coeffs, num_coeffs, points, results);
+    else
+        horner_batch<false, K>(ctx, coeffs, num_coeffs, points, results);
+}
+
+/// Evaluates the polynomial at the points xs[0..n) with the reduced coefficients
+/// using batches of 4 points.
+template <unsigned N>
+inline void poly_eval_points(const montgomery<N>& ctx, const uint<N>* coeffs, size_t num_coeffs,
+    const uint<N>* xs, uint<N>* results, size_t n) noexcept
+{
+    constexpr size_t batch_size = 4;
+
+    size_t i = 0;
+    for (; i + batch_size <= n; i += batch_size)
+        horner_points<batch_size>(ctx, coeffs, num_coeffs, &xs[i], &results[i]);
+    for (; i < n; ++i)
+        horner_points<1>(ctx, coeffs, num_coeffs, &xs[i], &results[i]);
+}
+
+/// The Horner's scheme with the division based reduction for even moduli.
+/// The umul_add() computes acc * x + c in full precision so only one reduction per step
+/// is needed.
+template <unsigned N>
+inline uint<N> poly_eval_generic(
+    const uint<N>* coeffs, size_t num_coeffs, const uint<N>& x, const uint<N>& mod) noexcept
+{
+    const auto xr = x % mod;
+    uint<N> acc;
+    for (size_t i = num_coeffs; i-- != 0;)
+        acc = umod(umul_add(acc, xr, coeffs[i] % mod), mod);
+    return acc;
+}
+
+/// The threads joined on destruction, also when starting a next one throws.
+struct thread_group
+{
+    std::vector<std::thread> threads;
+
+    ~thread_group()
+    {
+        for (auto& t : threads)
+            t.join();
+    }
+};
+}  // namespace internal
+
+/// Evaluates the polynomial with the coefficients coeffs[0..num_coeffs) modulo mod
+/// at the points xs[0..num_points) and stores the values in results[0..num_points).
+///
+/// The points are evaluated in batches interleaving independent Horner's schemes.
+/// With num_threads > 1 the points are split between this and additional threads.
+/// This requires linking with the threads library (link the intx::poly CMake target).
+template <unsigned N>
+inline void poly_eval_multi(const uint<N>* coeffs, size_t num_coeffs, const uint<N>* xs,
+    uint<N>* results, size_t num_points, const uint<N>& mod, unsigned num_threads = 1)
+{
+    if ((mod[0] & 1) == 0)
+    {
+        for (size_t i = 0; i < num_points; ++i)
+            results[i] = internal::poly_eval_generic(coeffs, num_coeffs, xs[i], mod);
+        return;
+    }
+
+    // Reduce the coefficients once for all points if needed.
+    std::vector<uint<N>> reduced;
+    for (size_t i = 0; i < num_coeffs; ++i)
+    {
+        if (coeffs[i] >= mod)
+        {
+            reduced.assign(coeffs, coeffs + num_coeffs);
+            for (auto& c : reduced)
+                c %= mod;
+            coeffs = reduced.data();
+            break;
+        }
+    }
+
+    const montgomery<N> ctx{mod};
+
+    const auto num_chunks = std::max(std::min(size_t{num_threads}, num_points / 4), size_t{1});
+    const auto chunk_begin = [=](size_t i) noexcept { return i * num_points / num_chunks; };
+
+    internal::thread_group group;
+    group.threads.reserve(num_chunks - 1);
+    for (size_t i = 1; i < num_chunks; ++i)
+    {
+        const auto begin = chunk_begin(i);
+        const auto n = chunk_begin(i + 1) - begin;
+        group.threads.emplace_back([&ctx, coeffs, num_coeffs, xs, results, begin, n] {
+            internal::poly_eval_points(ctx, coeffs, num_coeffs, &xs[begin], &results[begin], n);
+        });
+    }
+    internal::poly_eval_points(ctx, coeffs, num_coeffs, xs, results, chunk_begin(1));
+}
+
+/// Evaluates the polynomial with the coefficients coeffs[0..num_coeffs) at x modulo mod,
+/// i.e. computes the sum of coeffs[i] * x^i mod mod.
+///
+/// The coefficients are in the order of increasing powers and do not have to be reduced.
+/// For odd moduli the Montgomery multiplication is used, otherwise the full precision
+/// multiply-add followed by the division. The mod must not be zero.
+template <unsigned N>
+inline uint<N> poly_eval(
+    const uint<N>* coeffs, size_t num_coeffs, const uint<N>& x, const uint<N>& mod)
+{
+    uint<N> r;
+    poly_eval_multi(coeffs, num_coeffs, &x, &r, 1, mod);
+    return r;
+}
+}  // namespace intx
@@ -0,0 +1,234 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+/// @file
+/// Unsigned integers tracking the number of significant words.
+
+#pragma once
+
+#include <intx/intx.hpp>
+
+namespace intx
+{
+/// The uint<N> value with the cached number of its significant words.
+///
+/// The number of significant words is maintained incrementally by the arithmetic operators,
+/// so the multiplication and the division dispatch directly to the single word kernels
+/// or to the algorithms of the operands' lengths without scanning the words.
+/// This pays off when most of the values are small, e.g. less than 2^64.
+template <unsigned N>
+class uint_sized
+{
+    uint<N> m_value;
+    unsigned m_num_words = 0;
+
+public:
+    static constexpr auto num_words = static_cast<unsigned>(uint<N>::num_words);
+
+    constexpr uint_sized() noexcept = default;
+
+    constexpr uint_sized(uint64_t x) noexcept  // NOLINT(hicpp-explicit-conversions)
+      : m_value{x}, m_num_words{x != 0}
+    {}
+
+    constexpr explicit uint_sized(const uint<N>& x) noexcept : uint_sized{x, num_words} {}
+
+    /// Creates the value of at most max_num_words significant words.
+    /// The words above the bound must be zero.
+    constexpr uint_sized(const uint<N>& x, unsigned max_num_words) noexcept
+      : m_value{x}, m_num_words{max_num_words}
+    {
+        INTX_REQUIRE(max_num_words <= num_words);
+        while (m_num_words != 0 && m_value[m_num_words - 1] == 0)
+            --m_num_words;
+    }
+
+    [[nodiscard]] constexpr const uint<N>& value() const noexcept { return m_value; }
+
+    [[nodiscard]] constexpr unsigned num_significant_words() const noexcept
+    {
+        return m_num_words;
+    }
+
+    constexpr explicit operator uint<N>() const noexcept { return m_value; }
+};
+
+template <unsigned N>
+inline constexpr bool operator==(const uint_sized<N>& x, const uint_sized<N>& y) noexcept
+{
+    return x.num_significant_words() == y.num_significant_words() && x.value() == y.value();
+}
+
+template <unsigned N>
+inline constexpr bool operator!=(const uint_sized<N>& x, const uint_sized<N>& y) noexcept
+{
+    return !(x == y);
+}
+
+/// Compares the numbers of significant words first.
+template <unsigned N>
+inline constexpr bool operator<(const uint_sized<N>& x, const uint_sized<N>& y) noexcept
+{
+    if (x.num_significant_words() != y.num_significant_words())
+        return x.num_significant_words() < y.num_significant_words();
+    return x.value() < y.value();
+}
+
+template <unsigned N>
+inline constexpr bool operator>(const uint_sized<N>& x, const uint_sized<N>& y) noexcept
+{
+    return y < x;
+}
+
+template <unsigned N>
+inline constexpr bool operator<=(const uint_sized<N>& x, const uint_sized<N>& y) noexcept
+{
+    return !(y < x);
+}
+
+template <unsigned N>
+inline constexpr bool operator>=(const uint_sized<N>& x, const uint_sized<N>& y) noexcept
+{
+    return !(x < y);
+}
+
+template <unsigned N>
+inline constexpr uint_sized<N> operator+(const uint_sized<N>& x, const uint_sized<N>& y) noexcept
+{
+    const auto n = std::max(x.num_significant_words(), y.num_significant_words());
+    return {x.value() + y.value(), std::min(n + 1, uint_sized<N>::num_words)};
+}
+
+template <unsigned N>
+inline constexpr uint_sized<N> operator-(const uint_sized<N>& x, const uint_sized<N>& y) noexcept
+{
+    unsigned long long borrow = 0; // NOLINT(google-runtime-int)
+    const auto d = subc(x.value(), y.value(), &borrow);
+    const auto n = std::max(x.num_significant_words(), y.num_significant_words());
+    return {d, borrow ? uint_sized<N>::num_words : n};
+}
+
+namespace internal
+{
+/// Computes x * y truncated to N bits for the operands of nx and ny significant words.
+template <unsigned N>
+inline constexpr uint<N> mul_sized(
+    const uint<N>& x, unsigned nx, const uint<N>& y, unsigned ny) noexcept
+{
+    uint<N> r;
+    for (size_t i = 0; i < nx; ++i)
+    {
+        const auto len = std::min(size_t{ny}, uint<N>::num_words - i);
+        uint64_t k = 0;
+        for (size_t j = 0; j < len; ++j)
+        {
+            const auto p = umul(x[i], y[j]) + r[i + j] + k;
+            r[i + j] = p[0];
+            k = p[1];
+        }
+        if (i + len < uint<N>::num_words)
+            r[i + len] = k;
+    }
+    return r;
+}
+}  // namespace internal
+
+/// Multiplies with the single word kernels if any of the operands is a single word
+/// and only by the significant words of the operands otherwise.
+template <unsigned N>
+inline constexpr uint_sized<N> operator*(const uint_sized<N>& x, const uint_sized<N>& y) noexcept
+{
+    constexpr auto num_words = uint_sized<N>::num_words;
+    const auto nx = x.num_significant_words();
+    const auto ny = y.num_significant_words();
+
+    if (nx == 0 || ny == 0)
+        return {};
+
+    if (nx == 1 && ny == 1)
+    {
+        const auto p = umul(x.value()[0], y.value()[0]);
+        return {uint<N>{p[0], p[1]}, 2};
+    }
+
+    if (ny == 1)
+        return {mul_1(x.value(), y.value()[0]), std::min(nx + 1, num_words)};
+
+    if (nx == 1)
+        return {mul_1(y.value(), x.value()[0]), std::min(ny + 1, num_words)};
+
+    if (nx + ny <= num_words)
+        return {internal::mul_sized(x.value(), nx, y.value(), ny), nx + ny};
+
+    return {x.value() * y.value(), num_words};
+}
+
+/// Divides by the numbers of significant words of the arguments known in advance.
+/// The native division is used if both arguments are single words.
+template <unsigned N>
+inline div_result<uint_sized<N>> udivrem(const uint_sized<N>& u, const uint_sized<N>& v) noexcept
+{
+    const auto nu = u.num_significant_words();
+    const auto nv = v.num_significant_words();
+    INTX_REQUIRE(nv != 0);
+
+    if (nu < nv)
+        return {{}, u};
+
+    if (nu == 1)
+        return {u.value()[0] / v.value()[0], u.value()[0] % v.value()[0]};
+
+    if (nv == 1)
+    {
+        const auto res = divrem_1(u.value(), v.value()[0]);
+        return {{res.quot, nu}, res.rem};
+    }
+
+    const auto res = internal::udivrem_sized(
+        u.value(), v.value(), static_cast<int>(nu), static_cast<int>(nv));
+    return {{res.quot, nu - nv + 1}, {res.rem, nv}};
+}
+
+template <unsigned N>
+inline uint_sized<N> operator/(const uint_sized<N>& x, const uint_sized<N>& y) noexcept
+{
+    return udivrem(x, y).quot;
+}
+
+template <unsigned N>
+inline uint_sized<N> operator%(const uint_sized<N>& x, const uint_sized<N>& y) noexcept
+{
+    return udivrem(x, y).rem;
+}
+
+template <unsigned N>
+inline constexpr uint_sized<N>& operator+=(uint_sized<N>& x, const uint_sized<N>& y) noexcept
+{
+    return x = x + y;
+}
+
+template <unsigned N>
+inline constexpr uint_sized<N>& operator-=(uint_sized<N>& x, const uint_sized<N>& y) noexcept
+{
+    return x = x - y;
+}
+
+template <unsigned N>
+inline constexpr uint_sized<N>& operator*=(uint_sized<N>& x, const uint_sized<N>& y) noexcept
+{
+    return x = x * y;
+}
+
+template <unsigned N>
+inline uint_sized<N>& operator/=(uint_sized<N>& x, const uint_sized<N>& y) noexcept
+{
+    return x = x / y;
+}
+
+template <unsigned N>
+inline uint_sized<N>& operator%=(uint_sized<N>& x, const uint_sized<N>& y) noexcept
+{
+    return x = x % y;
+}
+}  // namespace intx
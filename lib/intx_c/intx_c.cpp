@@ -0,0 +1,171 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include "intx_c.h"
+#include <intx/intx.hpp>
+
+using namespace intx;
+
+namespace
+{
+/// The largest power of 10 fitting a word, the decimal conversions are done in chunks of
+/// this many digits.
+constexpr auto dec_chunk_digits = 19;
+constexpr uint64_t dec_chunk_base = 10'000'000'000'000'000'000u;
+
+template <typename T>
+inline auto load(const T& t) noexcept
+{
+    return le::load<intx::uint<sizeof(t.bytes) * 8>>(t.bytes);
+}
+
+template <typename T, unsigned N>
+inline void store(T& t, const intx::uint<N>& x) noexcept
+{
+    le::store(t.bytes, x);
+}
+
+template <typename T, typename Op>
+inline void binary_op_n(T* r, const T* a, const T* b, size_t n, Op op) noexcept
+{
+    for (size_t i = 0; i < n; ++i)
+        store(r[i], op(load(a[i]), load(b[i])));
+}
+
+/// Writes the decimal digits of x to the slot of size S. The digits are produced in chunks
+/// by the division by the word, from the end of the slot.
+template <size_t S, unsigned N>
+inline void to_dec(char* out, intx::uint<N> x) noexcept
+{
+    char buf[S];
+    auto p = &buf[S - 1];
+    do
+    {
+        const auto res = divrem_1(x, dec_chunk_base);
+        x = res.quot;
+        auto chunk = res.rem;
+        for (int i = 0; i < dec_chunk_digits && (chunk != 0 || x != 0); ++i)
+        {
+            *--p = static_cast<char>('0' + chunk % 10);
+            chunk /= 10;
+        }
+    } while (x != 0);
+    if (p == &buf[S - 1])
+        *--p = '0';
+
+    const auto len = static_cast<size_t>(&buf[S - 1] - p);
+    std::memcpy(out, p, len);
+    out[len] = '\0';
+}
+
+/// Parses the decimal digits in chunks. The value is accumulated in the integer wider by
+/// a word to detect the overflow after each chunk. Returns false if the string is invalid.
+template <size_t S, unsigned N>
+inline bool from_dec(intx::uint<N>& r, const char* s) noexcept
+{
+    intx::uint<N + 64> x;
+    size_t i = 0;
+    for (; i < S && s[i] != '\0';)
+    {
+        uint64_t chunk = 0;
+        uint64_t chunk_base = 1;
+        for (int k = 0; k < dec_chunk_digits && i < S && s[i] != '\0'; ++k, ++i)
+        {
+            const auto d = static_cast<uint64_t>(s[i] - '0');
+            if (d > 9)
+                return false;
+            chunk = chunk * 10 + d;
+            chunk_base *= 10;
+        }
+        x = mul_1(x, chunk_base) + chunk;
+        if (x[N / 64] != 0)
+            return false;
+    }
+    if (i == 0 || i == S)
+        return false;
+    r = static_cast<intx::uint<N>>(x);
+    return true;
+}
+}  // namespace
+
+extern "C" {
+
+void intx_add_n(intx_uint256* r, const intx_uint256* a, const intx_uint256* b, size_t n)
+{
+    binary_op_n(r, a, b, n, [](const uint256& x, const uint256& y) { return x + y; });
+}
+
+void intx_sub_n(intx_uint256* r, const intx_uint256* a, const intx_uint256* b, size_t n)
+{
+    binary_op_n(r, a, b, n, [](const uint256& x, const uint256& y) { return x - y; });
+}
+
+void intx_mul_n(intx_uint256* r, const intx_uint256* a, const intx_uint256* b, size_t n)
+{
+    binary_op_n(r, a, b, n, [](const uint256& x, const uint256& y) { return x * y; });
+}
+
+void intx_mulmod_n(intx_uint256* r, const intx_uint256* a, const intx_uint256* b,
+    const intx_uint256* mod, size_t n)
+{
+    const auto m = load(*mod);
+    if (m == 0)
+    {
+        std::memset(r, 0, n * sizeof(*r));
+        return;
+    }
+    binary_op_n(r, a, b, n, [&m](const uint256& x, const uint256& y) { return mulmod(x, y, m); });
+}
+
+void intx_to_dec_n(char* out, const intx_uint256* a, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        to_dec<INTX_UINT256_DEC_SIZE>(&out[i * INTX_UINT256_DEC_SIZE], load(a[i]));
+}
+
+size_t intx_from_dec_n(intx_uint256* r, const char* in, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        uint256 x;
+        if (!from_dec<INTX_UINT256_DEC_SIZE>(x, &in[i * INTX_UINT256_DEC_SIZE]))
+            return i;
+        store(r[i], x);
+    }
+    return n;
+}
+
+void intx_add512_n(intx_uint512* r, const intx_uint512* a, const intx_uint512* b, size_t n)
+{
+    binary_op_n(r, a, b, n, [](const uint512& x, const uint512& y) { return x + y; });
+}
+
+void intx_sub512_n(intx_uint512* r, const intx_uint512* a, const intx_uint512* b, size_t n)
+{
+    binary_op_n(r, a, b, n, [](const uint512& x, const uint512& y) { return x - y; });
+}
+
+void intx_mul512_n(intx_uint512* r, const intx_uint512* a, const intx_uint512* b, size_t n)
+{
+    binary_op_n(r, a, b, n, [](const uint512& x, const uint512& y) { return x * y; });
+}
+
+void intx_to_dec512_n(char* out, const intx_uint512* a, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+        to_dec<INTX_UINT512_DEC_SIZE>(&out[i * INTX_UINT512_DEC_SIZE], load(a[i]));
+}
+
+size_t intx_from_dec512_n(intx_uint512* r, const char* in, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        uint512 x;
+        if (!from_dec<INTX_UINT512_DEC_SIZE>(x, &in[i * INTX_UINT512_DEC_SIZE]))
+            return i;
+        store(r[i], x);
+    }
+    return n;
+}
+}
@@ -0,0 +1,102 @@
+/* intx: extended precision integer library.
+ * Copyright 2022 Pawel Bylica.
+ * Licensed under the Apache License, Version 2.0.
+ */
+
+/**
+ * @file
+ * The C API of intx for the FFI callers.
+ *
+ * The integers are passed as byte buffers in little-endian order. The operations process arrays
+ * of n elements per call to amortize the cost of the foreign function call. The results may
+ * alias the arguments. The arithmetic is modulo 2^256 (2^512) as in intx.
+ */
+
+#ifndef INTX_C_H
+#define INTX_C_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(_WIN32) && defined(INTX_C_BUILDING)
+    #define INTX_C_EXPORT __declspec(dllexport)
+#elif defined(_WIN32)
+    #define INTX_C_EXPORT __declspec(dllimport)
+#elif defined(__GNUC__)
+    #define INTX_C_EXPORT __attribute__((visibility("default")))
+#else
+    #define INTX_C_EXPORT
+#endif
+
+/** The 256-bit unsigned integer in little-endian order. */
+typedef struct intx_uint256
+{
+    uint8_t bytes[32];
+} intx_uint256;
+
+/** The 512-bit unsigned integer in little-endian order. */
+typedef struct intx_uint512
+{
+    uint8_t bytes[64];
+} intx_uint512;
+
+/**
+ * The size of the slot of the decimal string of a 256-bit (512-bit) integer:
+ * the max number of digits and the terminating null character.
+ */
+#define INTX_UINT256_DEC_SIZE 79
+#define INTX_UINT512_DEC_SIZE 156
+
+/** r[i] = a[i] + b[i] for i < n. */
+INTX_C_EXPORT void intx_add_n(
+    intx_uint256* r, const intx_uint256* a, const intx_uint256* b, size_t n);
+
+/** r[i] = a[i] - b[i] for i < n. */
+INTX_C_EXPORT void intx_sub_n(
+    intx_uint256* r, const intx_uint256* a, const intx_uint256* b, size_t n);
+
+/** r[i] = a[i] * b[i] for i < n. */
+INTX_C_EXPORT void intx_mul_n(
+    intx_uint256* r, const intx_uint256* a, const intx_uint256* b, size_t n);
+
+/**
+ * r[i] = a[i] * b[i] % *mod for i < n, with the common modulus.
+ * The results are 0 if the modulus is 0.
+ */
+INTX_C_EXPORT void intx_mulmod_n(intx_uint256* r, const intx_uint256* a, const intx_uint256* b,
+    const intx_uint256* mod, size_t n);
+
+/**
+ * Converts a[i] for i < n to the decimal strings. The i-th string is stored null-terminated
+ * in the slot out[i * INTX_UINT256_DEC_SIZE].
+ */
+INTX_C_EXPORT void intx_to_dec_n(char* out, const intx_uint256* a, size_t n);
+
+/**
+ * Parses the decimal strings from the slots in[i * INTX_UINT256_DEC_SIZE] for i < n.
+ * The strings must be null-terminated within the slot.
+ * Returns the number of the strings parsed before the first string being empty, having
+ * other characters than digits or a value out of the range.
+ */
+INTX_C_EXPORT size_t intx_from_dec_n(intx_uint256* r, const char* in, size_t n);
+
+/** The uint512 variants of the above. @{ */
+INTX_C_EXPORT void intx_add512_n(
+    intx_uint512* r, const intx_uint512* a, const intx_uint512* b, size_t n);
+INTX_C_EXPORT void intx_sub512_n(
+    intx_uint512* r, const intx_uint512* a, const intx_uint512* b, size_t n);
+INTX_C_EXPORT void intx_mul512_n(
+    intx_uint512* r, const intx_uint512* a, const intx_uint512* b, size_t n);
+INTX_C_EXPORT void intx_to_dec512_n(char* out, const intx_uint512* a, size_t n);
+INTX_C_EXPORT size_t intx_from_dec512_n(intx_uint512* r, const char* in, size_t n);
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INTX_C_H */
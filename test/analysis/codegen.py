@@ -0,0 +1,205 @@
+#!/usr/bin/env python3
+
+# intx: extended precision integer library.
+# Copyright 2022 Pawel Bylica.
+# Licensed under the Apache License, Version 2.0.
+
+"""Reports the instruction counts of the analysis kernels and compares them with the baseline.
+
+The kernels are the extern "C" functions with upper-case names in the object files.
+They are disassembled with objdump (x86-64, AT&T syntax). The counts cover the kernel body
+and the bodies of the functions it calls or tail-calls (transitively, each function once)
+found in the object files, e.g. the out-of-line udivrem_knuth() called from udivrem().
+The calls to other functions are counted but not followed. The alignment padding is not counted.
+
+Exits with 1 if any count is greater than in the baseline, with 77 (skipped) if the baseline
+has been generated by a different compiler.
+"""
+
+import argparse
+import re
+import subprocess
+import sys
+
+COLUMNS = ('insns', 'branches', 'calls', 'mul', 'adc')
+
+MUL = ('mul', 'imul', 'mulx')
+ADC = ('adc', 'sbb', 'adcx', 'adox')
+PADDING = ('xchg   %ax,%ax', 'int3')
+
+SKIP_RETURN_CODE = 77
+
+kernel_re = re.compile(r'^[A-Z][A-Z0-9_]*$')
+function_re = re.compile(r'^[0-9a-f]+ <(.+)>:$')
+reloc_re = re.compile(r'^\s+[0-9a-f]+: R_X86_64_\w+\s+([^+\-\s]+)')
+insn_re = re.compile(r'^\s+[0-9a-f]+:\s+(.*)$')
+# The padding is encoded with the segment and operand size prefixes: cs nopw, data16 cs nopw.
+prefixes_re = re.compile(r'^((cs|ds|data16)\s+)+')
+
+
+def err(*args, **kwargs):
+    print(*args, file=sys.stderr, **kwargs)
+
+
+def is_padding(insn):
+    return not insn or insn.startswith(PADDING) or insn.split()[0].startswith('nop')
+
+
+def mnemonic(insn):
+    m = insn.split()[0]
+    # Strip the operand size suffix of the AT&T syntax: mulq, adcq.
+    # Older binutils print the 64-bit call and jmp as callq and jmpq.
+    if m[:-1] in MUL + ADC + ('call', 'jmp') and m[-1] in 'bwlq':
+        m = m[:-1]
+    return m
+
+
+def count_functions(objdump, objects):
+    """Returns the counts and the called functions of all functions in the object files."""
+    disasm = subprocess.run([objdump, '-d', '-r', '--no-show-raw-insn'] + objects,
+                            check=True, capture_output=True, text=True).stdout
+    functions = {}
+    counts = None
+    callees = None
+    last_mnemonic = None
+    for line in disasm.splitlines():
+        f = function_re.match(line)
+        if f:
+            counts = callees = last_mnemonic = None
+            name = f.group(1)
+            # The inline functions are emitted in every object file using them. Count once.
+            if name not in functions:
+                counts = dict.fromkeys(COLUMNS, 0)
+                callees = set()
+                functions[name] = (counts, callees)
+            continue
+        if not line.strip():
+            counts = callees = None  # The end of the function.
+            continue
+        if counts is None:
+            continue
+        r = reloc_re.match(line)
+        if r:
+            # The target of the call or the tail-call jump in the not linked object file.
+            if last_mnemonic == 'call' or last_mnemonic == 'jmp':
+                callees.add(r.group(1))
+            continue
+        i = insn_re.match(line)
+        if not i:
+            continue
+        insn = prefixes_re.sub('', i.group(1))
+        if is_padding(insn):
+            continue
+        m = mnemonic(insn)
+        last_mnemonic = m
+        counts['insns'] += 1
+        if m.startswith('j'):
+            counts['branches'] += 1
+        elif m == 'call':
+            counts['calls'] += 1
+        elif m in MUL:
+            counts['mul'] += 1
+        elif m in ADC:
+            counts['adc'] += 1
+    return functions
+
+
+def count_kernels(objdump, objects):
+    functions = count_functions(objdump, objects)
+    kernels = {}
+    for name in functions:
+        if not kernel_re.match(name):
+            continue
+        total = dict.fromkeys(COLUMNS, 0)
+        visited = set()
+        stack = [name]
+        while stack:
+            fn = stack.pop()
+            if fn in visited or fn not in functions:
+                continue
+            visited.add(fn)
+            counts, callees = functions[fn]
+            for c in COLUMNS:
+                total[c] += counts[c]
+            stack.extend(callees)
+        kernels[name] = total
+    return kernels
+
+
+def format_table(kernels):
+    lines = ['# {:<16}'.format('kernel') + ''.join('{:>10}'.format(c) for c in COLUMNS)]
+    for name in sorted(kernels):
+        counts = kernels[name]
+        lines.append('{:<18}'.format(name) + ''.join('{:>10}'.format(counts[c]) for c in COLUMNS))
+    return '\n'.join(lines) + '\n'
+
+
+def load_baseline(path):
+    compiler = None
+    kernels = {}
+    with open(path) as f:
+        for line in f:
+            if line.startswith('# compiler:'):
+                compiler = line.split(':', 1)[1].strip()
+            elif line.strip() and not line.startswith('#'):
+                name, *values = line.split()
+                kernels[name] = dict(zip(COLUMNS, map(int, values)))
+    return compiler, kernels
+
+
+def compare(kernels, baseline):
+    regressions = 0
+    for name in sorted(kernels):
+        if name not in baseline:
+            print('{}: not in the baseline'.format(name))
+            continue
+        for c in COLUMNS:
+            new = kernels[name][c]
+            old = baseline[name][c]
+            if new > old:
+                print('{}: {} {} -> {} REGRESSION'.format(name, c, old, new))
+                regressions += 1
+            elif new < old:
+                print('{}: {} {} -> {} improved, update the baseline'.format(name, c, old, new))
+    for name in sorted(set(baseline) - set(kernels)):
+        print('{}: missing'.format(name))
+        regressions += 1
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument('--baseline', required=True, help='the baseline file')
+    parser.add_argument('--compiler', required=True, help='the compiler id and version')
+    parser.add_argument('--objdump', default='objdump', help='the objdump executable')
+    parser.add_argument('--update', action='store_true', help='write the baseline')
+    parser.add_argument('objects', nargs='+',
+                        help='the object files (the CMake lists separated by ; accepted)')
+    args = parser.parse_args()
+
+    objects = [o for arg in args.objects for o in arg.split(';') if o]
+    kernels = count_kernels(args.objdump, objects)
+    table = format_table(kernels)
+    print(table, end='')
+
+    if args.update:
+        with open(args.baseline, 'w') as f:
+            f.write('# compiler: {}\n'.format(args.compiler))
+            f.write(table)
+        print('written {}'.format(args.baseline))
+        return 0
+
+    compiler, baseline = load_baseline(args.baseline)
+    if compiler != args.compiler:
+        err('the baseline for {}, not comparing {}'.format(compiler, args.compiler))
+        return SKIP_RETURN_CODE
+
+    regressions = compare(kernels, baseline)
+    if regressions:
+        err('{} codegen regressions'.format(regressions))
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
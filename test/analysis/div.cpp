@@ -6,3 +6,33 @@ extern "C" div_result<uint64_t> UDIVREM_2BY1(uint128 u, uint64_t d, uint64_t v)
 {
     return udivrem_2by1(u, d, v);
 }
+
+extern "C" div_result<uint64_t, uint128> UDIVREM_3BY2(
+    uint64_t u2, uint64_t u1, uint64_t u0, uint128 d, uint64_t v)
+{
+    return udivrem_3by2(u2, u1, u0, d, v);
+}
+
+extern "C" uint64_t RECIPROCAL_2BY1(uint64_t d)
+{
+    return reciprocal_2by1(d);
+}
+
+extern "C" void UDIVREM256(div_result<uint256>& r, const uint256& x, const uint256& y)
+{
+    r = udivrem(x, y);
+}
+
+// The kernels of the division algorithms called by udivrem(). They are counted in UDIVREM256
+// and also tracked on their own.
+
+extern "C" uint64_t SUBMUL(
+    uint64_t r[], const uint64_t x[], const uint64_t y[], int len, uint64_t multiplier)
+{
+    return internal::submul(r, x, y, len, multiplier);
+}
+
+extern "C" void UDIVREM_KNUTH(uint64_t q[], uint64_t u[], int ulen, const uint64_t d[], int dlen)
+{
+    internal::udivrem_knuth(q, u, ulen, d, dlen);
+}
@@ -0,0 +1,18 @@
+#include <intx/intx.hpp>
+
+using namespace intx;
+
+extern "C" void MUL256(uint256& x, const uint256& y)
+{
+    x *= y;
+}
+
+extern "C" void UMUL256(uint512& p, const uint256& x, const uint256& y)
+{
+    p = umul(x, y);
+}
+
+extern "C" void MUL512(uint512& x, const uint512& y)
+{
+    x *= y;
+}
@@ -6,3 +6,8 @@ extern "C" void SUB256(uint256& x, const uint256& y)
 {
     x -= y;
 }
+
+extern "C" void SUB512(uint512& x, const uint512& y)
+{
+    x -= y;
+}
@@ -0,0 +1,127 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include <benchmark/benchmark.h>
+#include <intx/algorithm.hpp>
+#include <test/utils/random.hpp>
+#include <vector>
+
+using namespace intx;
+using namespace intx::test;
+
+namespace
+{
+/// The input sizes (in number of elements) fitting L1, L3 and only DRAM for uint256.
+#define SCAN_SIZES Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 21)
+
+template <typename Int>
+std::vector<Int> gen_scan_input(size_t n)
+{
+    // Values of mixed widths: some are decided by the top word, some need to compare all words.
+    lcg<Int> rng(get_seed());
+    std::vector<Int> values(n);
+    for (auto& v : values)
+    {
+        v = rng();
+        v >>= v[0] % Int::num_bits;
+    }
+    return values;
+}
+
+template <typename Int>
+const Int* count_ge_std(const Int* first, const Int* last, const Int& value) noexcept
+{
+    return first + std::count_if(first, last, [&value](const Int& x) { return x >= value; });
+}
+
+template <typename Int>
+const Int* count_ge_intx(const Int* first, const Int* last, const Int& value) noexcept
+{
+    return first + count_ge(first, last, value);
+}
+
+template <typename Int>
+const Int* find_first_ge_std(const Int* first, const Int* last, const Int& value) noexcept
+{
+    return std::find_if(first, last, [&value](const Int& x) { return x >= value; });
+}
+
+template <typename Int>
+const Int* min_element_std(const Int* first, const Int* last, const Int&) noexcept
+{
+    return std::min_element(first, last);
+}
+
+template <typename Int>
+const Int* min_element_intx(const Int* first, const Int* last, const Int&) noexcept
+{
+    return intx::min_element(first, last);
+}
+
+template <typename Int>
+const Int* max_element_std(const Int* first, const Int* last, const Int&) noexcept
+{
+    return std::max_element(first, last);
+}
+
+template <typename Int>
+const Int* max_element_intx(const Int* first, const Int* last, const Int&) noexcept
+{
+    return intx::max_element(first, last);
+}
+}  // namespace
+
+template <typename Int, const Int* ScanFn(const Int*, const Int*, const Int&)>
+static void scan(benchmark::State& state)
+{
+    const auto values = gen_scan_input<Int>(static_cast<size_t>(state.range(0)));
+    const auto first = values.data();
+    const auto last = first + values.size();
+
+    // The threshold larger than all values so that find scans the whole input.
+    const auto threshold = ~Int{0};
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        const auto r = ScanFn(first, last, threshold);
+        benchmark::DoNotOptimize(r);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * state.range(0) * int64_t{sizeof(Int)});
+}
+BENCHMARK_TEMPLATE(scan, uint256, count_ge_std)->SCAN_SIZES;
+BENCHMARK_TEMPLATE(scan, uint256, count_ge_intx)->SCAN_SIZES;
+BENCHMARK_TEMPLATE(scan, uint256, find_first_ge_std)->SCAN_SIZES;
+BENCHMARK_TEMPLATE(scan, uint256, find_first_ge)->SCAN_SIZES;
+BENCHMARK_TEMPLATE(scan, uint256, min_element_std)->SCAN_SIZES;
+BENCHMARK_TEMPLATE(scan, uint256, min_element_intx)->SCAN_SIZES;
+BENCHMARK_TEMPLATE(scan, uint256, max_element_std)->SCAN_SIZES;
+BENCHMARK_TEMPLATE(scan, uint256, max_element_intx)->SCAN_SIZES;
+BENCHMARK_TEMPLATE(scan, uint512, count_ge_std)->SCAN_SIZES;
+BENCHMARK_TEMPLATE(scan, uint512, count_ge_intx)->SCAN_SIZES;
+BENCHMARK_TEMPLATE(scan, uint512, min_element_std)->SCAN_SIZES;
+BENCHMARK_TEMPLATE(scan, uint512, min_element_intx)->SCAN_SIZES;
+
+template <typename Int>
+static void scan_equal_range(benchmark::State& state)
+{
+    auto values = gen_scan_input<Int>(static_cast<size_t>(state.range(0)));
+    std::sort(values.begin(), values.end());
+    const auto first = values.data();
+    const auto last = first + values.size();
+    const auto keys = gen_scan_input<Int>(num_samples);
+
+    while (state.KeepRunningBatch(num_samples))
+    {
+        for (const auto& key : keys)
+        {
+            const auto r = intx::equal_range(first, last, key);
+            benchmark::DoNotOptimize(r);
+        }
+    }
+}
+BENCHMARK_TEMPLATE(scan_equal_range, uint256)->SCAN_SIZES;
+BENCHMARK_TEMPLATE(scan_equal_range, uint512)->SCAN_SIZES;
+
+#undef SCAN_SIZES
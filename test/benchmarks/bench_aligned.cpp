@@ -0,0 +1,115 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include <benchmark/benchmark.h>
+#include <intx/aligned.hpp>
+#include <test/utils/random.hpp>
+#include <memory>
+#include <vector>
+
+using namespace intx;
+using namespace intx::test;
+
+namespace
+{
+/// The array of n Int values placed at the given byte offset from a cache line boundary.
+/// The offset 0 gives aligned elements, the offset 8 makes every other uint256 cross
+/// a cache line boundary.
+template <typename Int>
+class offset_array
+{
+    std::vector<uint8_t, aligned_allocator<uint8_t, 64>> storage_;
+    Int* data_ = nullptr;
+    size_t size_ = 0;
+
+public:
+    offset_array(size_t n, size_t offset) : storage_(n * sizeof(Int) + offset), size_{n}
+    {
+        data_ = reinterpret_cast<Int*>(&storage_[offset]);
+        std::uninitialized_value_construct_n(data_, n);
+
+        lcg<Int> rng(get_seed());
+        std::generate_n(data_, n, rng);
+    }
+
+    Int* data() noexcept { return data_; }
+    [[nodiscard]] size_t size() const noexcept { return size_; }
+};
+
+template <typename Int>
+void add_loop(Int* z, const Int* x, const Int* y, size_t n) noexcept
+{
+    for (size_t i = 0; i < n; ++i)
+        z[i] = x[i] + y[i];
+}
+
+template <typename Int>
+void mul_loop(Int* z, const Int* x, const Int* y, size_t n) noexcept
+{
+    for (size_t i = 0; i < n; ++i)
+        z[i] = x[i] * y[i];
+}
+
+template <typename Int>
+void be_store_loop(Int* z, const Int* x, const Int*, size_t n) noexcept
+{
+    auto out = reinterpret_cast<uint8_t*>(z);
+    for (size_t i = 0; i < n; ++i)
+        be::unsafe::store(&out[i * sizeof(Int)], x[i]);
+}
+}  // namespace
+
+template <typename Int, size_t Offset, void LoopFn(Int*, const Int*, const Int*, size_t)>
+static void aligned_array(benchmark::State& state)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    offset_array<Int> xs(n, Offset);
+    offset_array<Int> ys(n, Offset);
+    offset_array<Int> zs(n, Offset);
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        LoopFn(zs.data(), xs.data(), ys.data(), n);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// The array sizes for the 3 arrays to fit in L1 and in L3.
+#define ARRAY_SIZES Arg(256)->Arg(1 << 15)
+BENCHMARK_TEMPLATE(aligned_array, uint256, 0, add_loop)->ARRAY_SIZES;
+BENCHMARK_TEMPLATE(aligned_array, uint256, 8, add_loop)->ARRAY_SIZES;
+BENCHMARK_TEMPLATE(aligned_array, uint256, 0, mul_loop)->ARRAY_SIZES;
+BENCHMARK_TEMPLATE(aligned_array, uint256, 8, mul_loop)->ARRAY_SIZES;
+BENCHMARK_TEMPLATE(aligned_array, uint256, 0, be_store_loop)->ARRAY_SIZES;
+BENCHMARK_TEMPLATE(aligned_array, uint256, 8, be_store_loop)->ARRAY_SIZES;
+BENCHMARK_TEMPLATE(aligned_array, uint512, 0, add_loop)->ARRAY_SIZES;
+BENCHMARK_TEMPLATE(aligned_array, uint512, 8, add_loop)->ARRAY_SIZES;
+BENCHMARK_TEMPLATE(aligned_array, uint512, 0, be_store_loop)->ARRAY_SIZES;
+BENCHMARK_TEMPLATE(aligned_array, uint512, 8, be_store_loop)->ARRAY_SIZES;
+
+/// Compares arrays of uint192 (elements cross cache lines) with arrays of aligned_uint<192>
+/// (padded to 32 bytes).
+template <typename Int>
+static void aligned_uint192_add(benchmark::State& state)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    lcg<uint192> rng(get_seed());
+    std::vector<Int, aligned_allocator<Int>> xs(n);
+    std::vector<Int, aligned_allocator<Int>> ys(n);
+    std::vector<Int, aligned_allocator<Int>> zs(n);
+    std::generate(xs.begin(), xs.end(), rng);
+    std::generate(ys.begin(), ys.end(), rng);
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (size_t i = 0; i < n; ++i)
+            zs[i] = xs[i] + ys[i];
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(aligned_uint192_add, uint192)->ARRAY_SIZES;
+BENCHMARK_TEMPLATE(aligned_uint192_add, aligned_uint<192>)->ARRAY_SIZES;
+#undef ARRAY_SIZES
@@ -0,0 +1,113 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include <benchmark/benchmark.h>
+#include <intx/intx.hpp>
+#include <test/utils/random.hpp>
+
+using namespace intx;
+using namespace intx::test;
+
+namespace
+{
+/// Generates the random inputs of type T of the same width as uint<N>.
+template <typename T, unsigned N>
+std::vector<T> gen_inputs(seed_type seed)
+{
+    static_assert(sizeof(T) == sizeof(intx::uint<N>));
+    lcg<intx::uint<N>> rng(seed);
+    std::vector<T> v(num_samples);
+    for (auto& x : v)
+    {
+        const auto r = rng();
+        std::memcpy(&x, &r, sizeof(x));
+    }
+    return v;
+}
+
+template <typename T>
+T add(const T& x, const T& y) noexcept
+{
+    return x + y;
+}
+
+template <typename T>
+T sub(const T& x, const T& y) noexcept
+{
+    return x - y;
+}
+
+template <typename T>
+T mul(const T& x, const T& y) noexcept
+{
+    return x * y;
+}
+
+template <typename T>
+T lt(const T& x, const T& y) noexcept
+{
+    return x < y ? T{1} : T{0};
+}
+
+template <typename T>
+T eq(const T& x, const T& y) noexcept
+{
+    return x == y ? T{1} : T{0};
+}
+
+template <typename T>
+T shl(const T& x, const T& y) noexcept
+{
+    return x << (static_cast<uint64_t>(y) % (sizeof(T) * 8));
+}
+
+template <typename T>
+T shr(const T& x, const T& y) noexcept
+{
+    return x >> (static_cast<uint64_t>(y) % (sizeof(T) * 8));
+}
+}  // namespace
+
+/// Compares the uint<N> operations (T = uint<N>) with the compiler's unsigned _BitInt(N)
+/// (T = internal::bitint<N>). The uint<N> side uses the configuration of the _BitInt backend
+/// the benchmarks are built with, by default the portable implementations.
+template <typename T, unsigned N, T Op(const T&, const T&) noexcept>
+static void bitint_matrix(benchmark::State& state)
+{
+    const auto xs = gen_inputs<T, N>(get_seed());
+    const auto ys = gen_inputs<T, N>(get_seed() + 1);
+    std::vector<T> rs(num_samples);
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (size_t i = 0; i < num_samples; ++i)
+            rs[i] = Op(xs[i], ys[i]);
+        benchmark::DoNotOptimize(rs.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_samples));
+}
+
+#if INTX_HAS_BITINT
+    #define BENCHMARK_BITINT_OP(OP, N)                                                   \
+        BENCHMARK_TEMPLATE(bitint_matrix, intx::uint<N>, N, OP<intx::uint<N>>);          \
+        BENCHMARK_TEMPLATE(bitint_matrix, internal::bitint<N>, N, OP<internal::bitint<N>>)
+#else
+    #define BENCHMARK_BITINT_OP(OP, N) \
+        BENCHMARK_TEMPLATE(bitint_matrix, intx::uint<N>, N, OP<intx::uint<N>>)
+#endif
+
+#define BENCHMARK_BITINT_WIDTHS(OP) \
+    BENCHMARK_BITINT_OP(OP, 128);   \
+    BENCHMARK_BITINT_OP(OP, 256);   \
+    BENCHMARK_BITINT_OP(OP, 512);   \
+    BENCHMARK_BITINT_OP(OP, 1024)
+BENCHMARK_BITINT_WIDTHS(add);
+BENCHMARK_BITINT_WIDTHS(sub);
+BENCHMARK_BITINT_WIDTHS(mul);
+BENCHMARK_BITINT_WIDTHS(lt);
+BENCHMARK_BITINT_WIDTHS(eq);
+BENCHMARK_BITINT_WIDTHS(shl);
+BENCHMARK_BITINT_WIDTHS(shr);
+#undef BENCHMARK_BITINT_WIDTHS
+#undef BENCHMARK_BITINT_OP
@@ -0,0 +1,143 @@
+/* intx: extended precision integer library.
+ * Copyright 2022 Pawel Bylica.
+ * Licensed under the Apache License, Version 2.0.
+ */
+
+/**
+ * @file
+ * The benchmark of the intx_c API comparing the time per element of the batched calls
+ * with the calls for every element (n = 1), as done by the per-operation FFI shims.
+ */
+
+#include <intx_c.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define NUM_ELEMENTS 4096
+#define NUM_REPETITIONS 7
+
+static intx_uint256 a[NUM_ELEMENTS];
+static intx_uint256 b[NUM_ELEMENTS];
+static intx_uint256 r[NUM_ELEMENTS];
+static intx_uint256 mod;
+static char dec[NUM_ELEMENTS * INTX_UINT256_DEC_SIZE];
+
+static uint64_t rng_state = 0x9e3779b97f4a7c15;
+
+static uint64_t rng(void)
+{
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+static void fill(intx_uint256* x)
+{
+    size_t i;
+    for (i = 0; i < sizeof(x->bytes); i += sizeof(uint64_t))
+    {
+        const uint64_t w = rng();
+        memcpy(&x->bytes[i], &w, sizeof(w));
+    }
+}
+
+static double now_ns(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+/** The operations in the batched and in the per-element form. @{ */
+static void add_batched(size_t n)
+{
+    intx_add_n(r, a, b, n);
+}
+
+static void add_single(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; ++i)
+        intx_add_n(&r[i], &a[i], &b[i], 1);
+}
+
+static void mulmod_batched(size_t n)
+{
+    intx_mulmod_n(r, a, b, &mod, n);
+}
+
+static void mulmod_single(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; ++i)
+        intx_mulmod_n(&r[i], &a[i], &b[i], &mod, 1);
+}
+
+static void to_dec_batched(size_t n)
+{
+    intx_to_dec_n(dec, a, n);
+}
+
+static void to_dec_single(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; ++i)
+        intx_to_dec_n(&dec[i * INTX_UINT256_DEC_SIZE], &a[i], 1);
+}
+
+static void from_dec_batched(size_t n)
+{
+    intx_from_dec_n(r, dec, n);
+}
+
+static void from_dec_single(size_t n)
+{
+    size_t i;
+    for (i = 0; i < n; ++i)
+        intx_from_dec_n(&r[i], &dec[i * INTX_UINT256_DEC_SIZE], 1);
+}
+/** @} */
+
+/** Returns the min over the repetitions of the time per element in ns. */
+static double measure(void (*fn)(size_t))
+{
+    double best = 0;
+    int i;
+    for (i = 0; i < NUM_REPETITIONS; ++i)
+    {
+        const double start = now_ns();
+        fn(NUM_ELEMENTS);
+        const double t = (now_ns() - start) / NUM_ELEMENTS;
+        if (i == 0 || t < best)
+            best = t;
+    }
+    return best;
+}
+
+static void report(const char* name, void (*batched)(size_t), void (*single)(size_t))
+{
+    const double t_batched = measure(batched);
+    const double t_single = measure(single);
+    printf("%-10s %12.2f %12.2f %12.2f\n", name, t_batched, t_single, t_single - t_batched);
+}
+
+int main(void)
+{
+    size_t i;
+    for (i = 0; i < NUM_ELEMENTS; ++i)
+    {
+        fill(&a[i]);
+        fill(&b[i]);
+    }
+    fill(&mod);
+    intx_to_dec_n(dec, a, NUM_ELEMENTS);
+
+    printf("%-10s %12s %12s %12s\n", "op", "batched [ns]", "single [ns]", "per call");
+    report("add", add_batched, add_single);
+    report("mulmod", mulmod_batched, mulmod_single);
+    report("to_dec", to_dec_batched, to_dec_single);
+    report("from_dec", from_dec_batched, from_dec_single);
+    return 0;
+}
@@ -0,0 +1,213 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+/// @file
+/// The benchmarks replaying the inputs of the fuzz_intx fuzzer corpus.
+///
+/// Each file of the corpus directory is the op byte followed by two big-endian operands
+/// of the same width (128 to 4096 bits). The inputs are grouped by the operation and the width
+/// and the divisions additionally by the algorithm selected by the divisor length
+/// (by1, by2 or knuth), so the slow paths of the Knuth's division are tracked separately.
+/// The benchmarks are registered by intx-bench --corpus=<dir>.
+
+#include <benchmark/benchmark.h>
+#include <intx/intx.hpp>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+
+using namespace intx;
+
+namespace
+{
+/// The operations of fuzz_intx.cpp.
+enum class corpus_op : uint8_t
+{
+    divrem = 0x00,
+    mul = 0x01,
+    shl = 0x02,
+    lsr = 0x03,
+    add = 0x04,
+    sub = 0x05,
+    sdivrem = 0x06,
+};
+
+constexpr const char* corpus_op_names[] = {"divrem", "mul", "shl", "lsr", "add", "sub", "sdivrem"};
+
+template <unsigned N>
+using operands = std::pair<intx::uint<N>, intx::uint<N>>;
+
+template <unsigned N>
+intx::uint<N> run_op(corpus_op o, const intx::uint<N>& a, const intx::uint<N>& b) noexcept
+{
+    switch (o)
+    {
+    case corpus_op::divrem:
+    {
+        const auto res = udivrem(a, b);
+        return res.quot ^ res.rem;
+    }
+    case corpus_op::sdivrem:
+    {
+        const auto res = sdivrem(a, b);
+        return res.quot ^ res.rem;
+    }
+    case corpus_op::mul:
+        return a * b;
+    case corpus_op::shl:
+        return a << b;
+    case corpus_op::lsr:
+        return a >> b;
+    case corpus_op::add:
+        return a + b;
+    case corpus_op::sub:
+        return a - b;
+    }
+    return {};
+}
+
+/// Returns the name of the division algorithm for the divisor, as selected by udivrem().
+template <unsigned N>
+const char* division_kind(corpus_op o, const intx::uint<N>& b) noexcept
+{
+    const auto is_negative = o == corpus_op::sdivrem && (b >> (N - 1)) != 0;
+    switch (count_significant_words(is_negative ? -b : b))
+    {
+    case 1:
+        return "by1";
+    case 2:
+        return "by2";
+    default:
+        return "knuth";
+    }
+}
+
+/// The inputs of the given width grouped by the benchmark name.
+template <unsigned N>
+using input_groups = std::map<std::string, std::pair<corpus_op, std::vector<operands<N>>>>;
+
+template <unsigned N>
+void add_input(input_groups<N>& groups, const std::vector<uint8_t>& data)
+{
+    const auto o = static_cast<corpus_op>(data[0]);
+    const auto a = be::unsafe::load<intx::uint<N>>(&data[1]);
+    const auto b = be::unsafe::load<intx::uint<N>>(&data[1 + sizeof(a)]);
+
+    auto name = std::string{"corpus/"} + corpus_op_names[data[0]] + "/" + std::to_string(N);
+    if (o == corpus_op::divrem || o == corpus_op::sdivrem)
+    {
+        if (b == 0)
+            return;  // Skipped by the fuzzer too.
+        name += std::string{"/"} + division_kind(o, b);
+    }
+
+    auto& group = groups[name];
+    group.first = o;
+    group.second.emplace_back(a, b);
+}
+
+template <unsigned N>
+void register_groups(const input_groups<N>& groups)
+{
+    for (const auto& [name, group] : groups)
+    {
+        benchmark::RegisterBenchmark(
+            name.c_str(), [o = group.first, inputs = group.second](benchmark::State& state) {
+                for ([[maybe_unused]] auto _ : state)
+                {
+                    for (const auto& [a, b] : inputs)
+                    {
+                        const auto r = run_op(o, a, b);
+                        benchmark::DoNotOptimize(r);
+                    }
+                }
+                state.counters["inputs"] = static_cast<double>(inputs.size());
+                state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(inputs.size()));
+            });
+    }
+}
+
+struct corpus
+{
+    input_groups<128> inputs_128;
+    input_groups<256> inputs_256;
+    input_groups<512> inputs_512;
+    input_groups<1024> inputs_1024;
+    input_groups<2048> inputs_2048;
+    input_groups<4096> inputs_4096;
+
+    /// Adds the input if it has the fuzz_intx format. Returns false otherwise.
+    bool add(const std::vector<uint8_t>& data)
+    {
+        if (data.size() % 2 != 1 || data[0] >= std::size(corpus_op_names))
+            return false;
+
+        switch ((data.size() - 1) / 2 * 8)
+        {
+        case 128:
+            add_input(inputs_128, data);
+            break;
+        case 256:
+            add_input(inputs_256, data);
+            break;
+        case 512:
+            add_input(inputs_512, data);
+            break;
+        case 1024:
+            add_input(inputs_1024, data);
+            break;
+        case 2048:
+            add_input(inputs_2048, data);
+            break;
+        case 4096:
+            add_input(inputs_4096, data);
+            break;
+        default:
+            return false;
+        }
+        return true;
+    }
+};
+}  // namespace
+
+/// Loads the corpus from the directory (recursively) and registers the benchmarks.
+/// Returns false if the directory cannot be read.
+bool register_corpus_benchmarks(const std::string& dir)
+{
+    std::error_code ec;
+    std::filesystem::recursive_directory_iterator it{dir, ec};
+    if (ec)
+    {
+        std::cerr << "cannot read the corpus " << dir << ": " << ec.message() << '\n';
+        return false;
+    }
+
+    corpus c;
+    size_t num_loaded = 0;
+    size_t num_skipped = 0;
+    for (const auto& entry : it)
+    {
+        if (!entry.is_regular_file())
+            continue;
+        std::ifstream file{entry.path(), std::ios::binary};
+        const std::vector<uint8_t> data{
+            std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+        if (c.add(data))
+            ++num_loaded;
+        else
+            ++num_skipped;
+    }
+    std::cerr << "corpus: " << num_loaded << " inputs loaded, " << num_skipped
+              << " skipped (not in the fuzz_intx format)\n";
+
+    register_groups(c.inputs_128);
+    register_groups(c.inputs_256);
+    register_groups(c.inputs_512);
+    register_groups(c.inputs_1024);
+    register_groups(c.inputs_2048);
+    register_groups(c.inputs_4096);
+    return true;
+}
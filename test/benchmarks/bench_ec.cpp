@@ -0,0 +1,153 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include <benchmark/benchmark.h>
+#include <intx/ec.hpp>
+#include <test/utils/random.hpp>
+
+using namespace intx;
+using namespace intx::test;
+
+namespace
+{
+std::vector<uint256> gen_scalars(const ec::curve& c)
+{
+    lcg<uint256> rng(get_seed());
+    std::vector<uint256> v(16);
+    for (auto& k : v)
+        k = rng() % c.order();
+    return v;
+}
+}  // namespace
+
+/// The field multiplication: mulmod() vs the Montgomery multiplication.
+template <const ec::curve& Curve()>
+static void ec_field_mulmod(benchmark::State& state)
+{
+    const auto& c = Curve();
+    const auto xs = gen_scalars(c);
+    const auto& p = c.field().mod();
+
+    auto x = xs[0];
+    for ([[maybe_unused]] auto _ : state)
+    {
+        x = mulmod(x, xs[1], p);
+        benchmark::DoNotOptimize(x);
+    }
+}
+
+template <const ec::curve& Curve()>
+static void ec_field_mont_mul(benchmark::State& state)
+{
+    const auto& c = Curve();
+    const auto xs = gen_scalars(c);
+    const auto& f = c.field();
+
+    auto x = f.to_mont(xs[0]);
+    const auto y = f.to_mont(xs[1]);
+    for ([[maybe_unused]] auto _ : state)
+    {
+        x = f.mul(x, y);
+        benchmark::DoNotOptimize(x);
+    }
+}
+
+template <const ec::curve& Curve()>
+static void ec_dbl(benchmark::State& state)
+{
+    const auto& c = Curve();
+    auto p = c.to_jacobian(c.generator());
+    for ([[maybe_unused]] auto _ : state)
+    {
+        p = c.dbl(p);
+        benchmark::DoNotOptimize(p);
+    }
+}
+
+template <const ec::curve& Curve()>
+static void ec_add(benchmark::State& state)
+{
+    const auto& c = Curve();
+    const auto q = c.mul_g_jacobian(gen_scalars(c)[0]);
+    auto p = c.mul_g_jacobian(gen_scalars(c)[1]);
+    for ([[maybe_unused]] auto _ : state)
+    {
+        p = c.add(p, q);
+        benchmark::DoNotOptimize(p);
+    }
+}
+
+template <const ec::curve& Curve()>
+static void ec_add_mixed(benchmark::State& state)
+{
+    const auto& c = Curve();
+    const auto qa = c.mul_g(gen_scalars(c)[0]);
+    const ec::affine_point q{c.field().to_mont(qa.x), c.field().to_mont(qa.y)};
+    auto p = c.mul_g_jacobian(gen_scalars(c)[1]);
+    for ([[maybe_unused]] auto _ : state)
+    {
+        p = c.add_mixed(p, q);
+        benchmark::DoNotOptimize(p);
+    }
+}
+
+template <const ec::curve& Curve()>
+static void ec_mul(benchmark::State& state)
+{
+    const auto& c = Curve();
+    const auto ks = gen_scalars(c);
+    const auto p = c.mul_g(ks[15]);
+
+    size_t i = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        const auto r = c.mul(p, ks[i++ % 15]);
+        benchmark::DoNotOptimize(r);
+    }
+}
+
+template <const ec::curve& Curve()>
+static void ec_mul_g(benchmark::State& state)
+{
+    const auto& c = Curve();
+    const auto ks = gen_scalars(c);
+
+    size_t i = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        const auto r = c.mul_g(ks[i++ % ks.size()]);
+        benchmark::DoNotOptimize(r);
+    }
+}
+
+/// The u1 * G + u2 * Q as in the ECDSA verification and the public key recovery.
+template <const ec::curve& Curve()>
+static void ec_double_mul(benchmark::State& state)
+{
+    const auto& c = Curve();
+    const auto ks = gen_scalars(c);
+    const auto q = c.mul_g(ks[15]);
+
+    size_t i = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        const auto r = c.double_mul(ks[i % 15], ks[(i + 1) % 15], q);
+        ++i;
+        benchmark::DoNotOptimize(r);
+    }
+}
+
+#define BENCHMARK_CURVE(NAME)                        \
+    BENCHMARK_TEMPLATE(ec_field_mulmod, ec::NAME);   \
+    BENCHMARK_TEMPLATE(ec_field_mont_mul, ec::NAME); \
+    BENCHMARK_TEMPLATE(ec_dbl, ec::NAME);            \
+    BENCHMARK_TEMPLATE(ec_add, ec::NAME);            \
+    BENCHMARK_TEMPLATE(ec_add_mixed, ec::NAME);      \
+    BENCHMARK_TEMPLATE(ec_mul, ec::NAME);            \
+    BENCHMARK_TEMPLATE(ec_mul_g, ec::NAME);          \
+    BENCHMARK_TEMPLATE(ec_double_mul, ec::NAME)
+BENCHMARK_CURVE(secp256k1);
+BENCHMARK_CURVE(p256);
+BENCHMARK_CURVE(bn254);
+#undef BENCHMARK_CURVE
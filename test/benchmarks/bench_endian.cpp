@@ -0,0 +1,110 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+/// @file
+/// The benchmarks of the conversions to/from the byte orders: the generic conversion
+/// of the whole value vs the word conversions used by le:: and be::.
+///
+/// It does not depend on GMP so it can be built with the powerpc64 toolchain
+/// and run with qemu-user on x86-64 Linux:
+///   cmake -DCMAKE_TOOLCHAIN_FILE=cmake/toolchains/powerpc64.cmake ...
+///   qemu-ppc64-static -L /usr/powerpc64-linux-gnu test/intx-bench-endian
+
+#include <benchmark/benchmark.h>
+#include <intx/intx.hpp>
+#include <test/utils/random.hpp>
+
+using namespace intx;
+using namespace intx::test;
+
+namespace
+{
+/// The generic conversions: the copy of the whole value and the conversion of its words.
+/// @{
+template <typename T>
+T load_le_generic(const uint8_t* src) noexcept
+{
+    T x;
+    std::memcpy(&x, src, sizeof(x));
+    return to_little_endian(x);
+}
+
+template <typename T>
+T load_be_generic(const uint8_t* src) noexcept
+{
+    T x;
+    std::memcpy(&x, src, sizeof(x));
+    return to_big_endian(x);
+}
+
+template <typename T>
+void store_le_generic(uint8_t* dst, const T& x) noexcept
+{
+    const auto d = to_little_endian(x);
+    std::memcpy(dst, &d, sizeof(d));
+}
+
+template <typename T>
+void store_be_generic(uint8_t* dst, const T& x) noexcept
+{
+    const auto d = to_big_endian(x);
+    std::memcpy(dst, &d, sizeof(d));
+}
+/// @}
+}  // namespace
+
+template <typename T, T LoadFn(const uint8_t*) noexcept>
+static void load(benchmark::State& state)
+{
+    constexpr size_t n = 1024;
+    std::vector<uint8_t> bytes(n * sizeof(T));
+    lcg<uint64_t> rng(get_seed());
+    std::generate(bytes.begin(), bytes.end(), [&rng] { return static_cast<uint8_t>(rng()); });
+    std::vector<T> values(n);
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (size_t i = 0; i < n; ++i)
+            values[i] = LoadFn(&bytes[i * sizeof(T)]);
+        benchmark::DoNotOptimize(values.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bytes.size()));
+}
+
+template <typename T, void StoreFn(uint8_t*, const T&) noexcept>
+static void store(benchmark::State& state)
+{
+    constexpr size_t n = 1024;
+    lcg<T> rng(get_seed());
+    std::vector<T> values(n);
+    std::generate(values.begin(), values.end(), rng);
+    std::vector<uint8_t> bytes(n * sizeof(T));
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (size_t i = 0; i < n; ++i)
+            StoreFn(&bytes[i * sizeof(T)], values[i]);
+        benchmark::DoNotOptimize(bytes.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bytes.size()));
+}
+
+#define BENCHMARK_ENDIAN(T)                                    \
+    BENCHMARK_TEMPLATE(load, T, load_le_generic<T>);           \
+    BENCHMARK_TEMPLATE(load, T, internal::load_le_words<T>);   \
+    BENCHMARK_TEMPLATE(load, T, le::unsafe::load<T>);          \
+    BENCHMARK_TEMPLATE(load, T, load_be_generic<T>);           \
+    BENCHMARK_TEMPLATE(load, T, internal::load_be_words<T>);   \
+    BENCHMARK_TEMPLATE(load, T, be::unsafe::load<T>);          \
+    BENCHMARK_TEMPLATE(store, T, store_le_generic<T>);         \
+    BENCHMARK_TEMPLATE(store, T, internal::store_le_words<T>); \
+    BENCHMARK_TEMPLATE(store, T, le::unsafe::store<T>);        \
+    BENCHMARK_TEMPLATE(store, T, store_be_generic<T>);         \
+    BENCHMARK_TEMPLATE(store, T, internal::store_be_words<T>); \
+    BENCHMARK_TEMPLATE(store, T, be::unsafe::store<T>)
+BENCHMARK_ENDIAN(uint256);
+BENCHMARK_ENDIAN(uint512);
+#undef BENCHMARK_ENDIAN
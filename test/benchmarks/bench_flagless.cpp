@@ -0,0 +1,103 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+/// @file
+/// The benchmarks of the multiplication kernels for the architectures without the carry flag
+/// (internal::umul_flagless() etc.) vs the default ones.
+///
+/// It does not depend on GMP so it can be built with the riscv64 toolchain
+/// and run with qemu-user on x86-64 Linux:
+///   cmake -DCMAKE_TOOLCHAIN_FILE=cmake/toolchains/riscv64.cmake ...
+///   qemu-riscv64-static -L /usr/riscv64-linux-gnu test/intx-bench-flagless
+/// The toolchain enables Zba/Zbb if the compiler supports them (GCC 12+, set with
+/// -DCMAKE_CXX_COMPILER=riscv64-linux-gnu-g++-12); run them with -cpu rv64,zba=true,zbb=true.
+/// On RISC-V the default kernels are the flagless ones, so both give the same results there
+/// unless built with -DINTX_HAS_CARRY_FLAG=1.
+
+#include <benchmark/benchmark.h>
+#include <intx/intx.hpp>
+#include <test/utils/random.hpp>
+
+using namespace intx;
+using namespace intx::test;
+
+namespace
+{
+/// The kernels under test with the common signature. The high parts of the results
+/// (the high half of the umul() product, the borrow of submul()) are folded into them. @{
+template <unsigned N>
+intx::uint<N> umul_default(const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    const auto p = umul(x, y);
+    return static_cast<intx::uint<N>>(p) ^ static_cast<intx::uint<N>>(p >> N);
+}
+
+template <unsigned N>
+intx::uint<N> umul_flagless(const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    const auto p = internal::umul_flagless(x, y);
+    return static_cast<intx::uint<N>>(p) ^ static_cast<intx::uint<N>>(p >> N);
+}
+
+template <unsigned N>
+intx::uint<N> mul_default(const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    return x * y;
+}
+
+template <unsigned N>
+intx::uint<N> mul_flagless(const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    return internal::mul_flagless(x, y);
+}
+
+template <unsigned N>
+intx::uint<N> submul_default(const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    intx::uint<N> r;
+    r[0] ^= internal::submul(&r[0], &x[0], &y[0], intx::uint<N>::num_words, y[0]);
+    return r;
+}
+
+template <unsigned N>
+intx::uint<N> submul_flagless(const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    intx::uint<N> r;
+    r[0] ^= internal::submul_flagless(&r[0], &x[0], &y[0], intx::uint<N>::num_words, y[0]);
+    return r;
+}
+/// @}
+}  // namespace
+
+template <unsigned N, intx::uint<N> Fn(const intx::uint<N>&, const intx::uint<N>&) noexcept>
+static void binop(benchmark::State& state)
+{
+    lcg<intx::uint<N>> rng(get_seed());
+    std::vector<intx::uint<N>> xs(num_samples);
+    std::vector<intx::uint<N>> ys(num_samples);
+    std::generate(xs.begin(), xs.end(), rng);
+    std::generate(ys.begin(), ys.end(), rng);
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (size_t i = 0; i < num_samples; ++i)
+        {
+            const auto r = Fn(xs[i], ys[i]);
+            benchmark::DoNotOptimize(r);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_samples));
+}
+
+#define BENCHMARK_FLAGLESS(N)                        \
+    BENCHMARK_TEMPLATE(binop, N, umul_default<N>);   \
+    BENCHMARK_TEMPLATE(binop, N, umul_flagless<N>);  \
+    BENCHMARK_TEMPLATE(binop, N, mul_default<N>);    \
+    BENCHMARK_TEMPLATE(binop, N, mul_flagless<N>);   \
+    BENCHMARK_TEMPLATE(binop, N, submul_default<N>); \
+    BENCHMARK_TEMPLATE(binop, N, submul_flagless<N>)
+BENCHMARK_FLAGLESS(128);
+BENCHMARK_FLAGLESS(256);
+BENCHMARK_FLAGLESS(512);
+#undef BENCHMARK_FLAGLESS
@@ -0,0 +1,102 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include <benchmark/benchmark.h>
+#include <intx/fused.hpp>
+#include <test/utils/random.hpp>
+
+using namespace intx;
+using namespace intx::test;
+
+namespace
+{
+/// The plain operators: the product is truncated before the reduction (lossy).
+[[gnu::noinline]] uint256 mac_mod_plain(
+    const uint256& a, const uint256& b, const uint256& c, const uint256& m) noexcept
+{
+    return (a * b + c) % m;
+}
+
+/// The full precision result composed manually from umul() and udivrem().
+[[gnu::noinline]] uint256 mac_mod_composed(
+    const uint256& a, const uint256& b, const uint256& c, const uint256& m) noexcept
+{
+    const auto p = umul(a, b);
+    const auto s = intx::uint<576>{p} + intx::uint<576>{c};
+    return udivrem(s, m).rem;
+}
+
+[[gnu::noinline]] uint256 mac_mod_fused(
+    const uint256& a, const uint256& b, const uint256& c, const uint256& m) noexcept
+{
+    return (fused::lazy(a) * b + c) % m;
+}
+
+[[gnu::noinline]] uint256 mulmod_plain(
+    const uint256& a, const uint256& b, const uint256&, const uint256& m) noexcept
+{
+    return a * b % m;
+}
+
+[[gnu::noinline]] uint256 mulmod_fused(
+    const uint256& a, const uint256& b, const uint256&, const uint256& m) noexcept
+{
+    return fused::lazy(a) * b % m;
+}
+
+[[gnu::noinline]] uint256 two_products_mod_composed(
+    const uint256& a, const uint256& b, const uint256& c, const uint256& m) noexcept
+{
+    const auto s = intx::uint<576>{umul(a, b)} + intx::uint<576>{umul(c, m)};
+    return udivrem(s, m).rem;
+}
+
+[[gnu::noinline]] uint256 two_products_mod_fused(
+    const uint256& a, const uint256& b, const uint256& c, const uint256& m) noexcept
+{
+    using fused::lazy;
+    return (lazy(a) * b + lazy(c) * m) % m;
+}
+
+[[gnu::noinline]] uint256 mul_div_plain(
+    const uint256& a, const uint256& b, const uint256&, const uint256& m) noexcept
+{
+    return a * b / m;
+}
+
+[[gnu::noinline]] uint256 mul_div_fused(
+    const uint256& a, const uint256& b, const uint256&, const uint256& m) noexcept
+{
+    return fused::lazy(a) * b / m;
+}
+}  // namespace
+
+template <uint256 Fn(const uint256&, const uint256&, const uint256&, const uint256&)>
+static void fused_op(benchmark::State& state)
+{
+    const auto& xs = get_samples<uint256>(x_256);
+    const auto& ys = get_samples<uint256>(y_256);
+    const auto& zs = get_samples<uint256>(lt_256);
+    const auto& ms = get_samples<uint256>(state.range(0) == 128 ? x_128 : lt_x_256);
+
+    while (state.KeepRunningBatch(num_samples))
+    {
+        for (size_t i = 0; i < num_samples; ++i)
+        {
+            const auto _ = Fn(xs[i], ys[i], zs[i], ms[i]);
+            benchmark::DoNotOptimize(_);
+        }
+    }
+}
+#define ARGS Arg(128)->Arg(256)
+BENCHMARK_TEMPLATE(fused_op, mac_mod_plain)->ARGS;
+BENCHMARK_TEMPLATE(fused_op, mac_mod_composed)->ARGS;
+BENCHMARK_TEMPLATE(fused_op, mac_mod_fused)->ARGS;
+BENCHMARK_TEMPLATE(fused_op, mulmod_plain)->ARGS;
+BENCHMARK_TEMPLATE(fused_op, mulmod_fused)->ARGS;
+BENCHMARK_TEMPLATE(fused_op, two_products_mod_composed)->ARGS;
+BENCHMARK_TEMPLATE(fused_op, two_products_mod_fused)->ARGS;
+BENCHMARK_TEMPLATE(fused_op, mul_div_plain)->ARGS;
+BENCHMARK_TEMPLATE(fused_op, mul_div_fused)->ARGS;
+#undef ARGS
@@ -0,0 +1,142 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include <benchmark/benchmark.h>
+#include <intx/gmp.hpp>
+#include <test/utils/random.hpp>
+
+using namespace intx;
+using namespace intx::test;
+
+namespace
+{
+template <unsigned N>
+std::vector<intx::uint<N>> gen_inputs()
+{
+    lcg<intx::uint<N>> rng(get_seed());
+    std::vector<intx::uint<N>> v(num_samples);
+    for (auto& x : v)
+        x = rng();
+    return v;
+}
+
+template <unsigned N>
+void to_mpz_str(mpz_ptr r, const intx::uint<N>& x)
+{
+    mpz_set_str(r, to_string(x).c_str(), 10);
+}
+
+template <unsigned N>
+void to_mpz_limbs(mpz_ptr r, const intx::uint<N>& x)
+{
+    to_mpz(r, x);
+}
+
+template <unsigned N>
+intx::uint<N> from_mpz_str(mpz_srcptr x)
+{
+    char buf[2 * N];
+    mpz_get_str(buf, 10, x);
+    return from_string<intx::uint<N>>(buf);
+}
+
+template <unsigned N>
+intx::uint<N> from_mpz_limbs(mpz_srcptr x)
+{
+    return from_mpz<N>(x);
+}
+
+template <unsigned N>
+int cmp_mpz_copy(const intx::uint<N>& x, const intx::uint<N>& y)
+{
+    mpz_t a;
+    mpz_t b;
+    mpz_init(a);
+    mpz_init(b);
+    to_mpz(a, x);
+    to_mpz(b, y);
+    const auto c = mpz_cmp(a, b);
+    mpz_clears(a, b, NULL);  // NOLINT(cppcoreguidelines-pro-type-vararg)
+    return c;
+}
+
+template <unsigned N>
+int cmp_mpz_view(const intx::uint<N>& x, const intx::uint<N>& y)
+{
+    return mpz_cmp(mpz_view{x}, mpz_view{y});
+}
+}  // namespace
+
+/// The conversion of uint<N> to the initialized mpz_t.
+template <unsigned N, void Fn(mpz_ptr, const intx::uint<N>&)>
+static void gmp_to_mpz(benchmark::State& state)
+{
+    const auto inputs = gen_inputs<N>();
+    mpz_t z;
+    mpz_init(z);
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (const auto& x : inputs)
+        {
+            Fn(z, x);
+            benchmark::DoNotOptimize(mpz_limbs_read(z));
+        }
+    }
+    mpz_clear(z);
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_samples));
+}
+
+/// The conversion of mpz_t to uint<N>.
+template <unsigned N, intx::uint<N> Fn(mpz_srcptr)>
+static void gmp_from_mpz(benchmark::State& state)
+{
+    const auto inputs = gen_inputs<N>();
+    std::vector<mpz_t> zs(inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i)
+    {
+        mpz_init(zs[i]);
+        to_mpz(zs[i], inputs[i]);
+    }
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (const auto& z : zs)
+        {
+            const auto x = Fn(z);
+            benchmark::DoNotOptimize(x);
+        }
+    }
+
+    for (auto& z : zs)
+        mpz_clear(z);
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_samples));
+}
+
+/// The GMP operation (here mpz_cmp()) on uint<N> arguments: the temporary copies vs views.
+template <unsigned N, int Fn(const intx::uint<N>&, const intx::uint<N>&)>
+static void gmp_call(benchmark::State& state)
+{
+    const auto inputs = gen_inputs<N>();
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (size_t i = 1; i < inputs.size(); ++i)
+        {
+            const auto c = Fn(inputs[i - 1], inputs[i]);
+            benchmark::DoNotOptimize(c);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_samples - 1));
+}
+
+#define BENCHMARK_GMP_INTEROP(N)                                   \
+    BENCHMARK_TEMPLATE(gmp_to_mpz, N, to_mpz_str<N>);              \
+    BENCHMARK_TEMPLATE(gmp_to_mpz, N, to_mpz_limbs<N>);            \
+    BENCHMARK_TEMPLATE(gmp_from_mpz, N, from_mpz_str<N>);          \
+    BENCHMARK_TEMPLATE(gmp_from_mpz, N, from_mpz_limbs<N>);        \
+    BENCHMARK_TEMPLATE(gmp_call, N, cmp_mpz_copy<N>);              \
+    BENCHMARK_TEMPLATE(gmp_call, N, cmp_mpz_view<N>)
+BENCHMARK_GMP_INTEROP(256);
+BENCHMARK_GMP_INTEROP(512);
+BENCHMARK_GMP_INTEROP(1024);
+#undef BENCHMARK_GMP_INTEROP
@@ -0,0 +1,144 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include <benchmark/benchmark.h>
+#include <intx/intx.hpp>
+#include <test/utils/random.hpp>
+
+using namespace intx;
+using namespace intx::test;
+
+namespace
+{
+constexpr uint64_t word = 0x5851f42d4c957f2d;
+
+template <unsigned N>
+void add_copy(intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    x = x + y;
+}
+
+template <unsigned N>
+void add_inplace(intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    x += y;
+}
+
+template <unsigned N>
+void sub_copy(intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    x = x - y;
+}
+
+template <unsigned N>
+void sub_inplace(intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    x -= y;
+}
+
+template <unsigned N>
+void xor_copy(intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    x = x ^ y;
+}
+
+template <unsigned N>
+void xor_inplace(intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    x ^= y;
+}
+
+template <unsigned N>
+void shl_copy(intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    x = x << (y[0] % N);
+}
+
+template <unsigned N>
+void shl_inplace(intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    x <<= (y[0] % N);
+}
+
+template <unsigned N>
+void shr_copy(intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    x = x >> (y[0] % N);
+}
+
+template <unsigned N>
+void shr_inplace(intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    x >>= (y[0] % N);
+}
+
+template <unsigned N>
+void mul_word_copy(intx::uint<N>& x, const intx::uint<N>&) noexcept
+{
+    x = x * intx::uint<N>{word};
+}
+
+template <unsigned N>
+void mul_word_inplace(intx::uint<N>& x, const intx::uint<N>&) noexcept
+{
+    x *= word;
+}
+
+template <unsigned N>
+void addmul_copy(intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    x = x + y * intx::uint<N>{word};
+}
+
+template <unsigned N>
+void addmul_inplace(intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    addmul(x, y, word);
+}
+}  // namespace
+
+/// The compound assignment x op= y computed in place vs x = x op y via the temporary.
+template <unsigned N, void Op(intx::uint<N>&, const intx::uint<N>&) noexcept>
+static void inplace(benchmark::State& state)
+{
+    constexpr size_t num_inputs = 16;
+
+    lcg<intx::uint<N>> rng(get_seed());
+    std::vector<intx::uint<N>> xs(num_inputs);
+    std::vector<intx::uint<N>> ys(num_inputs);
+    for (size_t i = 0; i < num_inputs; ++i)
+    {
+        xs[i] = rng();
+        ys[i] = rng();
+    }
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (size_t i = 0; i < num_inputs; ++i)
+            Op(xs[i], ys[i]);
+        benchmark::DoNotOptimize(xs.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_inputs));
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(num_inputs * N / 8));
+}
+
+#define BENCHMARK_INPLACE_OP(OP, N)                 \
+    BENCHMARK_TEMPLATE(inplace, N, OP##_copy<N>);   \
+    BENCHMARK_TEMPLATE(inplace, N, OP##_inplace<N>)
+
+#define BENCHMARK_INPLACE(N)            \
+    BENCHMARK_INPLACE_OP(add, N);       \
+    BENCHMARK_INPLACE_OP(sub, N);       \
+    BENCHMARK_INPLACE_OP(xor, N);       \
+    BENCHMARK_INPLACE_OP(shl, N);       \
+    BENCHMARK_INPLACE_OP(shr, N);       \
+    BENCHMARK_INPLACE_OP(mul_word, N);  \
+    BENCHMARK_INPLACE_OP(addmul, N)
+BENCHMARK_INPLACE(512);
+BENCHMARK_INPLACE(1024);
+BENCHMARK_INPLACE(2048);
+BENCHMARK_INPLACE(4096);
+BENCHMARK_INPLACE(8192);
+#undef BENCHMARK_INPLACE
+#undef BENCHMARK_INPLACE_OP
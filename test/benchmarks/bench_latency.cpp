@@ -0,0 +1,154 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include <benchmark/benchmark.h>
+#include <intx/intx.hpp>
+#include <test/utils/random.hpp>
+
+using namespace intx;
+using namespace intx::test;
+
+namespace
+{
+/// Reads the time-stamp counter if available, otherwise returns 0.
+inline uint64_t read_cycles() noexcept
+{
+#if defined(__x86_64__) && defined(__GNUC__)
+    return __builtin_ia32_rdtsc();
+#else
+    return 0;
+#endif
+}
+
+/// The operations of the chain. They take the result of the previous operation as x.
+/// The operations returning other types than uint<N> fold their results into uint<N>.
+/// @{
+
+template <unsigned N>
+intx::uint<N> add(const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    return x + y;
+}
+
+template <unsigned N>
+intx::uint<N> sub(const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    return x - y;
+}
+
+template <unsigned N>
+intx::uint<N> mul(const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    return x * y;
+}
+
+template <unsigned N>
+intx::uint<N> umul_(const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    const auto p = umul(x, y);
+    return static_cast<intx::uint<N>>(p) ^ static_cast<intx::uint<N>>(p >> N);
+}
+
+/// Divides by the divisor of the half of the width (the y is shifted right).
+template <unsigned N>
+intx::uint<N> div(const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    return x / (y >> (N / 2));
+}
+
+template <unsigned N>
+intx::uint<N> shl(const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    return x << (y[0] % N);
+}
+
+template <unsigned N>
+intx::uint<N> shr(const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    return x >> (y[0] % N);
+}
+
+template <unsigned N>
+intx::uint<N> lt(const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    return x < y;
+}
+
+template <unsigned N>
+intx::uint<N> eq(const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    return x == y;
+}
+
+/// The modular operations with the modulus > 2^255 and the arguments shifted right
+/// so they are always reduced.
+constexpr auto modulus = 0x8cef2ea1b91a9e1a8b2e3cd4ac4d7e56f35bd1a37e6bc24fd14e1d02d4c5a903_u256;
+
+uint256 addmod_(const uint256& x, const uint256& y) noexcept
+{
+    return addmod(x >> 1, y >> 1, modulus);
+}
+
+uint256 mulmod_(const uint256& x, const uint256& y) noexcept
+{
+    return mulmod(x >> 1, y >> 1, modulus);
+}
+/// @}
+}  // namespace
+
+/// Measures the latency of the operation: the result of the operation is the operand
+/// of the next one. The result is mixed with a random value by XOR to keep the operands
+/// distributed as in the throughput benchmarks. The XOR has the latency of 1 cycle and
+/// is done on the independent words. Reports the time and the TSC cycles per operation.
+template <unsigned N, intx::uint<N> Op(const intx::uint<N>&, const intx::uint<N>&) noexcept>
+static void latency(benchmark::State& state)
+{
+    constexpr size_t num_ops = 1000;
+
+    lcg<intx::uint<N>> rng(get_seed());
+    std::vector<intx::uint<N>> ys(num_ops);
+    std::vector<intx::uint<N>> zs(num_ops);
+    for (size_t i = 0; i < num_ops; ++i)
+    {
+        ys[i] = rng();
+        zs[i] = rng();
+    }
+    auto x = rng();
+
+    uint64_t cycles = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        const auto start = read_cycles();
+        for (size_t i = 0; i < num_ops; ++i)
+            x = Op(x, ys[i]) ^ zs[i];
+        cycles += read_cycles() - start;
+    }
+    benchmark::DoNotOptimize(x);
+
+    const auto total_ops = state.iterations() * static_cast<int64_t>(num_ops);
+    state.counters["time_per_op"] = benchmark::Counter(static_cast<double>(total_ops),
+        benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+    if (cycles != 0)
+        state.counters["cycles_per_op"] =
+            static_cast<double>(cycles) / static_cast<double>(total_ops);
+}
+
+#define BENCHMARK_LATENCY(N)                  \
+    BENCHMARK_TEMPLATE(latency, N, add<N>);   \
+    BENCHMARK_TEMPLATE(latency, N, sub<N>);   \
+    BENCHMARK_TEMPLATE(latency, N, mul<N>);   \
+    BENCHMARK_TEMPLATE(latency, N, umul_<N>); \
+    BENCHMARK_TEMPLATE(latency, N, div<N>);   \
+    BENCHMARK_TEMPLATE(latency, N, shl<N>);   \
+    BENCHMARK_TEMPLATE(latency, N, shr<N>);   \
+    BENCHMARK_TEMPLATE(latency, N, lt<N>);    \
+    BENCHMARK_TEMPLATE(latency, N, eq<N>)
+BENCHMARK_LATENCY(128);
+BENCHMARK_LATENCY(192);
+BENCHMARK_LATENCY(256);
+BENCHMARK_LATENCY(384);
+BENCHMARK_LATENCY(512);
+#undef BENCHMARK_LATENCY
+BENCHMARK_TEMPLATE(latency, 256, addmod_);
+BENCHMARK_TEMPLATE(latency, 256, mulmod_);
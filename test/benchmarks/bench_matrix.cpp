@@ -0,0 +1,389 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+/// @file
+/// The matrix of the operations x widths x implementations.
+///
+/// Every operation is run for every width through every available backend:
+/// intx uint<N>, the GMP low-level mpn functions, the GMP mpz integers, the Clang
+/// unsigned _BitInt(N) and the builtin unsigned __int128 (128-bit only).
+/// After the regular benchmark output the results are printed as the markdown table
+/// of the time per operation and the speed of the backend relative to intx
+/// (> 1 means the backend is faster than intx).
+///
+/// Options (in addition to the Google Benchmark ones):
+///   --matrix_csv=<file>  Writes the results as CSV to the file.
+///   --matrix_md=<file>   Writes the markdown table to the file instead of the standard output.
+
+#include <benchmark/benchmark.h>
+#include <intx/gmp.hpp>
+#include <test/utils/options.hpp>
+#include <test/utils/random.hpp>
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace intx;
+using namespace intx::test;
+
+namespace
+{
+enum class op
+{
+    add,
+    sub,
+    mul,
+    div,
+    mod,
+    lt,
+    shl,
+    shr,
+};
+
+constexpr const char* op_names[] = {"add", "sub", "mul", "div", "mod", "lt", "shl", "shr"};
+
+constexpr const char* get_op_name(op o) noexcept
+{
+    return op_names[static_cast<int>(o)];
+}
+
+/// The backend of the types with the builtin operators: uint<N>, _BitInt(N) and __int128.
+template <typename T, unsigned N>
+struct native_backend
+{
+    using value_type = T;
+
+    static void load(value_type& r, const intx::uint<N>& x) noexcept
+    {
+        static_assert(sizeof(T) == sizeof(x));
+        std::memcpy(&r, &x, sizeof(r));
+    }
+
+    template <op Op>
+    static void compute(value_type& r, const value_type& x, const value_type& y) noexcept
+    {
+        if constexpr (Op == op::add)
+            r = x + y;
+        else if constexpr (Op == op::sub)
+            r = x - y;
+        else if constexpr (Op == op::mul)
+            r = x * y;
+        else if constexpr (Op == op::div)
+            r = x / y;
+        else if constexpr (Op == op::mod)
+            r = x % y;
+        else if constexpr (Op == op::lt)
+            r = static_cast<T>(x < y);
+        else if constexpr (Op == op::shl)
+            r = x << (static_cast<uint64_t>(y) % N);
+        else if constexpr (Op == op::shr)
+            r = x >> (static_cast<uint64_t>(y) % N);
+    }
+};
+
+/// The backend of the GMP low-level functions operating on the fixed number of limbs.
+/// The multiplication computes the full product and truncates it.
+template <unsigned N>
+struct mpn_backend
+{
+    using value_type = intx::uint<N>;
+    static constexpr auto num_limbs = static_cast<mp_size_t>(value_type::num_words);
+
+    static void load(value_type& r, const intx::uint<N>& x) noexcept { r = x; }
+
+    static mp_ptr limbs(value_type& x) noexcept { return reinterpret_cast<mp_ptr>(as_words(x)); }
+
+    static mp_srcptr limbs(const value_type& x) noexcept
+    {
+        return reinterpret_cast<mp_srcptr>(as_words(x));
+    }
+
+    template <op Op>
+    static void compute(value_type& r, const value_type& x, const value_type& y) noexcept
+    {
+        if constexpr (Op == op::add)
+            mpn_add_n(limbs(r), limbs(x), limbs(y), num_limbs);
+        else if constexpr (Op == op::sub)
+            mpn_sub_n(limbs(r), limbs(x), limbs(y), num_limbs);
+        else if constexpr (Op == op::mul)
+        {
+            intx::uint<2 * N> p;
+            mpn_mul_n(reinterpret_cast<mp_ptr>(as_words(p)), limbs(x), limbs(y), num_limbs);
+            r = static_cast<value_type>(p);
+        }
+        else if constexpr (Op == op::div || Op == op::mod)
+        {
+            const auto y_limbs = static_cast<mp_size_t>(count_significant_words(y));
+            value_type q;
+            value_type rem;
+            mpn_tdiv_qr(limbs(q), limbs(rem), 0, limbs(x), num_limbs, limbs(y), y_limbs);
+            r = Op == op::div ? q : rem;
+        }
+        else if constexpr (Op == op::lt)
+            r = mpn_cmp(limbs(x), limbs(y), num_limbs) < 0;
+        else if constexpr (Op == op::shl || Op == op::shr)
+        {
+            const auto shift = y[0] % N;
+            const auto word_shift = static_cast<mp_size_t>(shift / 64);
+            const auto bit_shift = static_cast<unsigned>(shift % 64);
+            const auto len = num_limbs - word_shift;
+            r = 0;
+            auto* rp = limbs(r);
+            const auto* xp = limbs(x);
+            if constexpr (Op == op::shl)
+            {
+                if (bit_shift != 0)
+                    mpn_lshift(rp + word_shift, xp, len, bit_shift);
+                else
+                    mpn_copyi(rp + word_shift, xp, len);
+            }
+            else
+            {
+                if (bit_shift != 0)
+                    mpn_rshift(rp, xp + word_shift, len, bit_shift);
+                else
+                    mpn_copyi(rp, xp + word_shift, len);
+            }
+        }
+    }
+};
+
+/// The mpz_t with the automatic initialization and cleanup.
+struct mpz_value
+{
+    mpz_t value;
+
+    mpz_value() noexcept { mpz_init(value); }
+    ~mpz_value() noexcept { mpz_clear(value); }
+    mpz_value(const mpz_value&) = delete;
+    mpz_value& operator=(const mpz_value&) = delete;
+};
+
+/// The backend of the GMP arbitrary precision integers. The results are not truncated to N bits.
+template <unsigned N>
+struct mpz_backend
+{
+    using value_type = mpz_value;
+
+    static void load(value_type& r, const intx::uint<N>& x) noexcept { to_mpz(r.value, x); }
+
+    template <op Op>
+    static void compute(value_type& r, const value_type& x, const value_type& y) noexcept
+    {
+        if constexpr (Op == op::add)
+            mpz_add(r.value, x.value, y.value);
+        else if constexpr (Op == op::sub)
+            mpz_sub(r.value, x.value, y.value);
+        else if constexpr (Op == op::mul)
+            mpz_mul(r.value, x.value, y.value);
+        else if constexpr (Op == op::div)
+            mpz_tdiv_q(r.value, x.value, y.value);
+        else if constexpr (Op == op::mod)
+            mpz_tdiv_r(r.value, x.value, y.value);
+        else if constexpr (Op == op::lt)
+            mpz_set_ui(r.value, mpz_cmp(x.value, y.value) < 0);
+        else if constexpr (Op == op::shl)
+            mpz_mul_2exp(r.value, x.value, mpz_getlimbn(y.value, 0) % N);
+        else if constexpr (Op == op::shr)
+            mpz_tdiv_q_2exp(r.value, x.value, mpz_getlimbn(y.value, 0) % N);
+    }
+};
+
+/// Runs the operation over the random inputs. The divisors have the half of the width.
+template <typename B, unsigned N, op Op>
+void matrix(benchmark::State& state)
+{
+    using T = typename B::value_type;
+    std::vector<T> xs(num_samples);
+    std::vector<T> ys(num_samples);
+    std::vector<T> rs(num_samples);
+
+    lcg<intx::uint<N>> rng(get_seed());
+    for (size_t i = 0; i < num_samples; ++i)
+    {
+        B::load(xs[i], rng());
+        const auto y = rng();
+        B::load(ys[i], (Op == op::div || Op == op::mod) ? y >> (N / 2) : y);
+    }
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (size_t i = 0; i < num_samples; ++i)
+            B::template compute<Op>(rs[i], xs[i], ys[i]);
+        benchmark::DoNotOptimize(rs.data());
+    }
+    state.counters["time_per_op"] =
+        benchmark::Counter(static_cast<double>(state.iterations()) * num_samples,
+            benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+template <typename B, unsigned N>
+void register_backend(const char* backend_name)
+{
+    const auto register_op = [backend_name](auto op_constant) {
+        constexpr auto o = decltype(op_constant)::value;
+        const auto name =
+            std::string{get_op_name(o)} + "/" + std::to_string(N) + "/" + backend_name;
+        benchmark::RegisterBenchmark(name.c_str(), matrix<B, N, o>);
+    };
+    register_op(std::integral_constant<op, op::add>{});
+    register_op(std::integral_constant<op, op::sub>{});
+    register_op(std::integral_constant<op, op::mul>{});
+    register_op(std::integral_constant<op, op::div>{});
+    register_op(std::integral_constant<op, op::mod>{});
+    register_op(std::integral_constant<op, op::lt>{});
+    register_op(std::integral_constant<op, op::shl>{});
+    register_op(std::integral_constant<op, op::shr>{});
+}
+
+template <unsigned N>
+void register_width()
+{
+    register_backend<native_backend<intx::uint<N>, N>, N>("intx");
+    register_backend<mpn_backend<N>, N>("gmp_mpn");
+    register_backend<mpz_backend<N>, N>("gmp_mpz");
+#if INTX_HAS_BITINT
+    if constexpr (internal::has_bitint<N>)
+        register_backend<native_backend<internal::bitint<N>, N>, N>("bitint");
+#endif
+#if INTX_HAS_BUILTIN_INT128
+    if constexpr (N == 128)
+        register_backend<native_backend<builtin_uint128, N>, N>("int128");
+#endif
+}
+
+/// Passes the results to the console reporter and collects them for the matrix.
+class matrix_reporter : public benchmark::ConsoleReporter
+{
+public:
+    /// The backend names in the order of the first appearance.
+    std::vector<std::string> backends;
+
+    /// The time per operation in ns by the "op/width" row and the backend.
+    /// The minimum is kept if the benchmark is repeated.
+    std::map<std::string, std::map<std::string, double>> results;
+
+    /// The row names in the order of the first appearance.
+    std::vector<std::string> rows;
+
+    void ReportRuns(const std::vector<Run>& runs) override
+    {
+        ConsoleReporter::ReportRuns(runs);
+        for (const auto& run : runs)
+        {
+            if (run.error_occurred || run.run_type != Run::RT_Iteration)
+                continue;
+
+            const auto name = run.run_name.function_name;
+            const auto sep = name.rfind('/');
+            const auto row = name.substr(0, sep);
+            const auto backend = name.substr(sep + 1);
+            const auto ns = run.counters.at("time_per_op").value * 1e9;
+
+            if (std::find(rows.begin(), rows.end(), row) == rows.end())
+                rows.push_back(row);
+            if (std::find(backends.begin(), backends.end(), backend) == backends.end())
+                backends.push_back(backend);
+
+            auto& cell = results[row][backend];
+            cell = cell == 0 ? ns : std::min(cell, ns);
+        }
+    }
+
+    [[nodiscard]] double relative_to_intx(const std::string& row, double ns) const
+    {
+        const auto& r = results.at(row);
+        const auto it = r.find("intx");
+        return it != r.end() ? it->second / ns : 0;
+    }
+
+    void write_markdown(std::ostream& out) const
+    {
+        out << "| op | bits |";
+        for (const auto& b : backends)
+            out << ' ' << b << " |";
+        out << "\n|----|-----:|";
+        for (size_t i = 0; i < backends.size(); ++i)
+            out << "-----:|";
+        out << '\n' << std::fixed;
+
+        for (const auto& row : rows)
+        {
+            const auto sep = row.find('/');
+            out << "| " << row.substr(0, sep) << " | " << row.substr(sep + 1) << " |";
+            const auto& r = results.at(row);
+            for (const auto& b : backends)
+            {
+                const auto it = r.find(b);
+                if (it == r.end())
+                    out << " |";
+                else if (b == "intx")
+                    out << ' ' << std::setprecision(2) << it->second << " |";
+                else
+                    out << ' ' << std::setprecision(2) << it->second << " (" << std::setprecision(2)
+                        << relative_to_intx(row, it->second) << "x) |";
+            }
+            out << '\n';
+        }
+    }
+
+    void write_csv(std::ostream& out) const
+    {
+        out << "op,bits,backend,ns_per_op,relative_to_intx\n";
+        for (const auto& row : rows)
+        {
+            const auto sep = row.find('/');
+            for (const auto& [b, ns] : results.at(row))
+            {
+                out << row.substr(0, sep) << ',' << row.substr(sep + 1) << ',' << b << ',' << ns
+                    << ',' << relative_to_intx(row, ns) << '\n';
+            }
+        }
+    }
+};
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    const auto csv_path = take_option(argc, argv, "matrix_csv");
+    const auto md_path = take_option(argc, argv, "matrix_md");
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+        return 1;
+
+    register_width<128>();
+    register_width<256>();
+    register_width<512>();
+    register_width<1024>();
+
+    matrix_reporter reporter;
+    benchmark::RunSpecifiedBenchmarks(&reporter);
+
+    if (md_path.empty())
+    {
+        std::cout << '\n';
+        reporter.write_markdown(std::cout);
+    }
+    else
+    {
+        std::ofstream md{md_path};
+        reporter.write_markdown(md);
+    }
+
+    if (!csv_path.empty())
+    {
+        std::ofstream csv{csv_path};
+        reporter.write_csv(csv);
+    }
+
+    benchmark::Shutdown();
+    return 0;
+}
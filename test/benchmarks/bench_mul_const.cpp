@@ -0,0 +1,99 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include <benchmark/benchmark.h>
+#include <intx/intx.hpp>
+#include <test/utils/random.hpp>
+
+using namespace intx;
+using namespace intx::test;
+
+namespace
+{
+/// The shapes of the constants. The words are listed from the least significant.
+template <unsigned N>
+struct pow10_18
+{
+    static constexpr intx::uint<N> value{1000000000000000000};
+    static auto mul_const(const intx::uint<N>& x) noexcept
+    {
+        return intx::mul_const<1000000000000000000>(x);
+    }
+};
+
+template <unsigned N>
+struct lcg_multiplier
+{
+    static constexpr intx::uint<N> value{0x5851f42d4c957f2d};
+    static auto mul_const(const intx::uint<N>& x) noexcept
+    {
+        return intx::mul_const<0x5851f42d4c957f2d>(x);
+    }
+};
+
+/// 2^128 + 1.
+template <unsigned N>
+struct sparse
+{
+    static constexpr intx::uint<N> value{1, 0, 1};
+    static auto mul_const(const intx::uint<N>& x) noexcept { return intx::mul_const<1, 0, 1>(x); }
+};
+
+/// The secp256k1 field prime 2^256 - 2^32 - 977.
+template <unsigned N>
+struct dense
+{
+    static constexpr auto ones = ~uint64_t{0};
+    static constexpr intx::uint<N> value{0xfffffffefffffc2f, ones, ones, ones};
+    static auto mul_const(const intx::uint<N>& x) noexcept
+    {
+        return intx::mul_const<0xfffffffefffffc2f, ones, ones, ones>(x);
+    }
+};
+
+template <unsigned N, template <unsigned> class C>
+[[gnu::noinline]] intx::uint<N> mul_public(const intx::uint<N>& x) noexcept
+{
+    return x * C<N>::value;
+}
+
+template <unsigned N, template <unsigned> class C>
+[[gnu::noinline]] intx::uint<N> mul_const(const intx::uint<N>& x) noexcept
+{
+    return C<N>::mul_const(x);
+}
+}  // namespace
+
+/// The multiplication by the constant: mul_const() vs operator* with the constant operand.
+template <unsigned N, intx::uint<N> MulFn(const intx::uint<N>&) noexcept>
+static void mul_by_const(benchmark::State& state)
+{
+    lcg<intx::uint<N>> rng(get_seed());
+    std::vector<intx::uint<N>> xs(num_samples);
+    for (auto& x : xs)
+        x = rng();
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (const auto& x : xs)
+        {
+            const auto r = MulFn(x);
+            benchmark::DoNotOptimize(r);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(xs.size()));
+}
+
+#define BENCHMARK_MUL_CONST(N, C)                          \
+    BENCHMARK_TEMPLATE(mul_by_const, N, mul_public<N, C>); \
+    BENCHMARK_TEMPLATE(mul_by_const, N, mul_const<N, C>)
+BENCHMARK_MUL_CONST(256, pow10_18);
+BENCHMARK_MUL_CONST(256, lcg_multiplier);
+BENCHMARK_MUL_CONST(256, sparse);
+BENCHMARK_MUL_CONST(256, dense);
+BENCHMARK_MUL_CONST(512, pow10_18);
+BENCHMARK_MUL_CONST(512, lcg_multiplier);
+BENCHMARK_MUL_CONST(512, sparse);
+BENCHMARK_MUL_CONST(512, dense);
+#undef BENCHMARK_MUL_CONST
@@ -0,0 +1,104 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include <benchmark/benchmark.h>
+#include <intx/montgomery.hpp>
+#include <test/utils/random.hpp>
+
+using namespace intx;
+using namespace intx::test;
+
+namespace
+{
+/// The secp256k1 base field prime.
+constexpr auto odd_mod = 0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f_u256;
+
+/// The K independent chains r[k] = op(r[k], y[k]). Each element of a chain depends on
+/// the previous one, so a single chain is bound by the operation latency.
+template <size_t K>
+struct chains
+{
+    uint256 r[K];
+    uint256 y[K];
+    uint256 mod[K];
+
+    chains()
+    {
+        lcg<uint256> rng(get_seed());
+        for (size_t k = 0; k < K; ++k)
+        {
+            r[k] = rng() % odd_mod;
+            y[k] = rng() % odd_mod;
+            mod[k] = odd_mod;
+        }
+    }
+};
+
+template <size_t K>
+void mulmod_single(chains<K>& c, const montgomery<256>&) noexcept
+{
+    for (size_t k = 0; k < K; ++k)
+        c.r[k] = mulmod(c.r[k], c.y[k], c.mod[k]);
+}
+
+template <size_t K>
+void mulmod_multi(chains<K>& c, const montgomery<256>&) noexcept
+{
+    mulmod(c.r, c.r, c.y, c.mod);
+}
+
+template <size_t K>
+void mont_mul_single(chains<K>& c, const montgomery<256>& ctx) noexcept
+{
+    for (size_t k = 0; k < K; ++k)
+        c.r[k] = ctx.mul(c.r[k], c.y[k]);
+}
+
+template <size_t K>
+void mont_mul_multi(chains<K>& c, const montgomery<256>& ctx) noexcept
+{
+    ctx.mul(c.r, c.r, c.y);
+}
+
+template <size_t K>
+void powmod_single(chains<K>& c, const montgomery<256>& ctx) noexcept
+{
+    for (size_t k = 0; k < K; ++k)
+        c.r[k] = ctx.pow(c.r[k], c.y[k]);
+}
+
+template <size_t K>
+void powmod_multi(chains<K>& c, const montgomery<256>& ctx) noexcept
+{
+    ctx.pow(c.r, c.r, c.y);
+}
+}  // namespace
+
+/// Reports the throughput per element of the K interleaved chains.
+template <size_t K, void Fn(chains<K>&, const montgomery<256>&) noexcept>
+static void multi_buffer(benchmark::State& state)
+{
+    const montgomery<256> ctx{odd_mod};
+    chains<K> c;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        Fn(c, ctx);
+        benchmark::DoNotOptimize(c.r);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(K));
+}
+
+#define BENCHMARK_MULTI_BUFFER(OP)                            \
+    BENCHMARK_TEMPLATE(multi_buffer, 1, OP##_single<1>);      \
+    BENCHMARK_TEMPLATE(multi_buffer, 1, OP##_multi<1>);       \
+    BENCHMARK_TEMPLATE(multi_buffer, 2, OP##_single<2>);      \
+    BENCHMARK_TEMPLATE(multi_buffer, 2, OP##_multi<2>);       \
+    BENCHMARK_TEMPLATE(multi_buffer, 4, OP##_single<4>);      \
+    BENCHMARK_TEMPLATE(multi_buffer, 4, OP##_multi<4>);       \
+    BENCHMARK_TEMPLATE(multi_buffer, 8, OP##_single<8>);      \
+    BENCHMARK_TEMPLATE(multi_buffer, 8, OP##_multi<8>)
+BENCHMARK_MULTI_BUFFER(mulmod);
+BENCHMARK_MULTI_BUFFER(mont_mul);
+BENCHMARK_MULTI_BUFFER(powmod);
+#undef BENCHMARK_MULTI_BUFFER
@@ -0,0 +1,144 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+/// @file
+/// The benchmarks of the multiversioned kernels (intx/multiversion.hpp) vs the default ones
+/// compiled for the target of the build. The label is the ISA level of the versions selected
+/// for the host CPU. Compare with the build for the host CPU (-march=native) to check
+/// how much of the difference the run-time dispatch recovers.
+/// Configure with -DINTX_MULTIVERSIONING=ON, otherwise the mv:: kernels are the default ones.
+
+#include <benchmark/benchmark.h>
+#include <intx/multiversion.hpp>
+#include <test/utils/random.hpp>
+
+using namespace intx;
+using namespace intx::test;
+
+namespace
+{
+/// The default kernels with the signatures of the multiversioned ones.
+/// The high half of the umul() product and the remainder are folded into the results. @{
+template <unsigned N>
+intx::uint<N> umul_default(const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    const auto p = umul(x, y);
+    return static_cast<intx::uint<N>>(p) ^ static_cast<intx::uint<N>>(p >> N);
+}
+
+template <unsigned N>
+intx::uint<N> umul_mv(const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    const auto p = mv::umul(x, y);
+    return static_cast<intx::uint<N>>(p) ^ static_cast<intx::uint<N>>(p >> N);
+}
+
+template <unsigned N>
+intx::uint<N> mul_default(const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    return x * y;
+}
+
+template <unsigned N>
+intx::uint<N> udivrem_default(const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    const auto [q, r] = udivrem(x, y);
+    return q ^ r;
+}
+
+template <unsigned N>
+intx::uint<N> udivrem_mv(const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    const auto [q, r] = mv::udivrem(x, y);
+    return q ^ r;
+}
+
+template <unsigned N>
+intx::uint<N> shl_default(const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    return x << static_cast<uint64_t>(y[0] % N);
+}
+
+template <unsigned N>
+intx::uint<N> shl_mv(const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    return mv::shl(x, static_cast<uint64_t>(y[0] % N));
+}
+
+template <unsigned N>
+intx::uint<N> xor_default(const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    return x ^ y;
+}
+/// @}
+}  // namespace
+
+template <unsigned N, intx::uint<N> Fn(const intx::uint<N>&, const intx::uint<N>&) noexcept>
+static void binop(benchmark::State& state)
+{
+    lcg<intx::uint<N>> rng(get_seed());
+    std::vector<intx::uint<N>> xs(num_samples);
+    std::vector<intx::uint<N>> ys(num_samples);
+    std::generate(xs.begin(), xs.end(), rng);
+    // Divisors of the 3/4 of the dividend's length go to the Knuth's division.
+    std::generate(ys.begin(), ys.end(), [&rng] { return (rng() >> (N / 4)) | 1; });
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (size_t i = 0; i < num_samples; ++i)
+        {
+            const auto r = Fn(xs[i], ys[i]);
+            benchmark::DoNotOptimize(r);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_samples));
+    state.SetLabel(mv::selected_isa());
+}
+
+template <unsigned N, void LoadFn(intx::uint<N>*, const uint8_t*, size_t) noexcept>
+static void load_n(benchmark::State& state)
+{
+    constexpr size_t n = 1024;
+    std::vector<uint8_t> bytes(n * sizeof(intx::uint<N>));
+    lcg<uint64_t> rng(get_seed());
+    std::generate(bytes.begin(), bytes.end(), [&rng] { return static_cast<uint8_t>(rng()); });
+    std::vector<intx::uint<N>> values(n);
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        LoadFn(values.data(), bytes.data(), n);
+        benchmark::DoNotOptimize(values.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(bytes.size()));
+    state.SetLabel(mv::selected_isa());
+}
+
+namespace
+{
+template <unsigned N>
+void be_load_n_default(intx::uint<N>* r, const uint8_t* src, size_t n) noexcept
+{
+    for (size_t i = 0; i < n; ++i)
+        r[i] = be::unsafe::load<intx::uint<N>>(&src[i * sizeof(intx::uint<N>)]);
+}
+}  // namespace
+
+#define BENCHMARK_MULTIVERSION(N)                        \
+    BENCHMARK_TEMPLATE(binop, N, umul_default<N>);       \
+    BENCHMARK_TEMPLATE(binop, N, umul_mv<N>);            \
+    BENCHMARK_TEMPLATE(binop, N, mul_default<N>);        \
+    BENCHMARK_TEMPLATE(binop, N, mv::mul<N>);            \
+    BENCHMARK_TEMPLATE(binop, N, udivrem_default<N>);    \
+    BENCHMARK_TEMPLATE(binop, N, udivrem_mv<N>);         \
+    BENCHMARK_TEMPLATE(binop, N, shl_default<N>);        \
+    BENCHMARK_TEMPLATE(binop, N, shl_mv<N>);             \
+    BENCHMARK_TEMPLATE(load_n, N, be_load_n_default<N>); \
+    BENCHMARK_TEMPLATE(load_n, N, mv::be_load_n<N>)
+BENCHMARK_MULTIVERSION(256);
+BENCHMARK_MULTIVERSION(512);
+#undef BENCHMARK_MULTIVERSION
+
+BENCHMARK_TEMPLATE(binop, 4096, xor_default<4096>);
+BENCHMARK_TEMPLATE(binop, 4096, mv::bit_xor<4096>);
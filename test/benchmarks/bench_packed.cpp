@@ -0,0 +1,101 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include <benchmark/benchmark.h>
+#include <intx/packed.hpp>
+#include <test/utils/random.hpp>
+#include <algorithm>
+
+using namespace intx;
+using namespace intx::test;
+
+namespace
+{
+using address = uint_packed<20>;
+
+/// Generates the random 160-bit values stored in the type T.
+template <typename T>
+std::vector<T> gen_addresses(size_t n, seed_type seed)
+{
+    lcg<uint256> rng(seed);
+    std::vector<T> v;
+    v.reserve(n);
+    for (size_t i = 0; i < n; ++i)
+        v.push_back(static_cast<T>(rng() >> 96));
+    return v;
+}
+
+template <typename T>
+void set_memory_counters(benchmark::State& state, size_t n)
+{
+    state.counters["bytes_per_elem"] = static_cast<double>(sizeof(T));
+    state.counters["MiB"] = static_cast<double>(n * sizeof(T)) / (1024 * 1024);
+}
+}  // namespace
+
+/// Sorts the range(0) of 160-bit values stored as T.
+template <typename T>
+static void packed_sort(benchmark::State& state)
+{
+    const auto n = static_cast<size_t>(state.range(0));
+    const auto input = gen_addresses<T>(n, get_seed());
+    auto v = input;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        state.PauseTiming();
+        v = input;
+        state.ResumeTiming();
+        std::sort(v.begin(), v.end());
+        benchmark::DoNotOptimize(v.data());
+    }
+    set_memory_counters<T>(state, n);
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n));
+}
+
+/// Looks up the random (mostly absent) and the present values in the sorted range(0) values.
+template <typename T>
+static void packed_lookup(benchmark::State& state)
+{
+    constexpr size_t num_queries = 1024;
+    const auto n = static_cast<size_t>(state.range(0));
+    auto v = gen_addresses<T>(n, get_seed());
+    std::sort(v.begin(), v.end());
+
+    auto queries = gen_addresses<T>(num_queries, get_seed() + 1);
+    for (size_t i = 0; i < num_queries; i += 2)
+        queries[i] = v[(i * 7919) % n];
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        size_t found = 0;
+        for (const auto& q : queries)
+            found += std::binary_search(v.begin(), v.end(), q);
+        benchmark::DoNotOptimize(found);
+    }
+    set_memory_counters<T>(state, n);
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_queries));
+}
+
+/// Hashes the range(0) values.
+static void packed_hash(benchmark::State& state)
+{
+    const auto v = gen_addresses<address>(static_cast<size_t>(state.range(0)), get_seed());
+    for ([[maybe_unused]] auto _ : state)
+    {
+        size_t h = 0;
+        for (const auto& x : v)
+            h ^= std::hash<address>{}(x);
+        benchmark::DoNotOptimize(h);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define BENCHMARK_PACKED(T)                                                                     \
+    BENCHMARK_TEMPLATE(packed_sort, T)->Arg(1 << 16)->Arg(1 << 22)->Unit(benchmark::kMillisecond); \
+    BENCHMARK_TEMPLATE(packed_lookup, T)->Arg(1 << 16)->Arg(1 << 22)
+BENCHMARK_PACKED(address);
+BENCHMARK_PACKED(uint192);
+BENCHMARK_PACKED(uint256);
+#undef BENCHMARK_PACKED
+BENCHMARK(packed_hash)->Arg(1 << 16);
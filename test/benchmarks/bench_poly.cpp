@@ -0,0 +1,110 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include <benchmark/benchmark.h>
+#include <intx/poly.hpp>
+#include <test/utils/random.hpp>
+
+using namespace intx;
+using namespace intx::test;
+
+namespace
+{
+/// The BN254 base field prime: 254 bits, the lazy reduction is used.
+constexpr auto bn254_p =
+    0x30644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd47_u256;
+
+/// The secp256k1 base field prime: 256 bits, every step is fully reduced.
+constexpr auto secp256k1_p =
+    0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f_u256;
+
+/// The even modulus: the umul_add() and division are used.
+constexpr auto even_mod = bn254_p + 1;
+
+/// The Horner's scheme with separate mulmod() and addmod() in every step.
+[[gnu::noinline]] uint256 poly_eval_naive(
+    const uint256* coeffs, size_t num_coeffs, const uint256& x, const uint256& mod) noexcept
+{
+    uint256 acc;
+    for (size_t i = num_coeffs; i-- != 0;)
+        acc = addmod(mulmod(acc, x, mod), coeffs[i], mod);
+    return acc;
+}
+
+[[gnu::noinline]] uint256 poly_eval_public(
+    const uint256* coeffs, size_t num_coeffs, const uint256& x, const uint256& mod) noexcept
+{
+    return poly_eval(coeffs, num_coeffs, x, mod);
+}
+
+std::vector<uint256> gen_reduced(size_t n, const uint256& mod)
+{
+    lcg<uint256> rng(get_seed());
+    std::vector<uint256> v(n);
+    for (auto& x : v)
+        x = rng() % mod;
+    return v;
+}
+}  // namespace
+
+template <const uint256& Mod,
+    uint256 EvalFn(const uint256*, size_t, const uint256&, const uint256&) noexcept>
+static void poly_eval_single(benchmark::State& state)
+{
+    const auto num_coeffs = static_cast<size_t>(state.range(0));
+    const auto coeffs = gen_reduced(num_coeffs, Mod);
+    const auto xs = gen_reduced(16, Mod);
+    auto mod = Mod;
+    benchmark::DoNotOptimize(mod);  // Prevent specialization for the constant modulus.
+
+    size_t i = 0;
+    for ([[maybe_unused]] auto _ : state)
+    {
+        const auto r = EvalFn(coeffs.data(), num_coeffs, xs[i++ % xs.size()], mod);
+        benchmark::DoNotOptimize(r);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(poly_eval_single, bn254_p, poly_eval_naive)->Arg(1000);
+BENCHMARK_TEMPLATE(poly_eval_single, bn254_p, poly_eval_public)->Arg(1000);
+BENCHMARK_TEMPLATE(poly_eval_single, secp256k1_p, poly_eval_naive)->Arg(1000);
+BENCHMARK_TEMPLATE(poly_eval_single, secp256k1_p, poly_eval_public)->Arg(1000);
+BENCHMARK_TEMPLATE(poly_eval_single, even_mod, poly_eval_naive)->Arg(1000);
+BENCHMARK_TEMPLATE(poly_eval_single, even_mod, poly_eval_public)->Arg(1000);
+
+/// Evaluates the degree-1000 polynomial at range(0) points with range(1) threads.
+/// The threads == 0 case uses the single point poly_eval() for every point.
+template <const uint256& Mod>
+static void poly_eval_points(benchmark::State& state)
+{
+    const auto num_points = static_cast<size_t>(state.range(0));
+    const auto num_threads = static_cast<unsigned>(state.range(1));
+    const auto coeffs = gen_reduced(1000, Mod);
+    const auto xs = gen_reduced(num_points, Mod);
+    std::vector<uint256> results(num_points);
+    auto mod = Mod;
+    benchmark::DoNotOptimize(mod);
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        if (num_threads == 0)
+        {
+            for (size_t i = 0; i < num_points; ++i)
+                results[i] = poly_eval(coeffs.data(), coeffs.size(), xs[i], mod);
+        }
+        else
+        {
+            poly_eval_multi(coeffs.data(), coeffs.size(), xs.data(), results.data(), num_points,
+                mod, num_threads);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(poly_eval_points, bn254_p)
+    ->ArgsProduct({{64, 1024}, {0, 1, 4}})
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(poly_eval_points, secp256k1_p)
+    ->ArgsProduct({{64, 1024}, {0, 1, 4}})
+    ->UseRealTime();
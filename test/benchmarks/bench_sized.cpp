@@ -0,0 +1,105 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include <benchmark/benchmark.h>
+#include <intx/sized.hpp>
+#include <test/utils/random.hpp>
+
+using namespace intx;
+using namespace intx::test;
+
+namespace
+{
+template <typename T>
+struct value_bits;
+
+template <unsigned N>
+struct value_bits<intx::uint<N>>
+{
+    static constexpr unsigned value = N;
+};
+
+template <unsigned N>
+struct value_bits<uint_sized<N>>
+{
+    static constexpr unsigned value = N;
+};
+
+/// Generates the values of which 7 of 8 are less than 2^64 and the rest are of the full size.
+template <typename T>
+std::vector<T> gen_skewed(size_t n, seed_type seed)
+{
+    constexpr auto N = value_bits<T>::value;
+    lcg<intx::uint<N>> rng(seed);
+    std::vector<T> v;
+    v.reserve(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        auto x = rng();
+        if (i % 8 != 0)
+            x = x[0];
+        if (x == 0)
+            x = 1;
+        v.emplace_back(x);
+    }
+    return v;
+}
+
+template <typename T>
+T add(const T& x, const T& y) noexcept
+{
+    return x + y;
+}
+
+template <typename T>
+T mul(const T& x, const T& y) noexcept
+{
+    return x * y;
+}
+
+template <typename T>
+T div(const T& x, const T& y) noexcept
+{
+    return x / y;
+}
+
+template <typename T>
+T mod(const T& x, const T& y) noexcept
+{
+    return x % y;
+}
+}  // namespace
+
+/// The binary operation over the skewed values of the type T: uint<N> vs uint_sized<N>.
+template <typename T, T Op(const T&, const T&) noexcept>
+static void sized_binop(benchmark::State& state)
+{
+    constexpr size_t num_inputs = 1000;
+    const auto xs = gen_skewed<T>(num_inputs, get_seed());
+    const auto ys = gen_skewed<T>(num_inputs, get_seed() + 1);
+
+    for ([[maybe_unused]] auto _ : state)
+    {
+        for (size_t i = 0; i < num_inputs; ++i)
+        {
+            const auto r = Op(xs[i], ys[i]);
+            benchmark::DoNotOptimize(r);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_inputs));
+}
+
+#define BENCHMARK_SIZED_OP(OP, N)                                      \
+    BENCHMARK_TEMPLATE(sized_binop, intx::uint<N>, OP<intx::uint<N>>); \
+    BENCHMARK_TEMPLATE(sized_binop, uint_sized<N>, OP<uint_sized<N>>)
+
+#define BENCHMARK_SIZED(N)      \
+    BENCHMARK_SIZED_OP(add, N); \
+    BENCHMARK_SIZED_OP(mul, N); \
+    BENCHMARK_SIZED_OP(div, N); \
+    BENCHMARK_SIZED_OP(mod, N)
+BENCHMARK_SIZED(256);
+BENCHMARK_SIZED(512);
+#undef BENCHMARK_SIZED
+#undef BENCHMARK_SIZED_OP
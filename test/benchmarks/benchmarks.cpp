@@ -18,28 +18,30 @@ using namespace intx;
 using namespace intx::test;
 
 
+/// Selects the divisor samples set by the number of significant bits in the benchmark argument.
+static samples_set_id get_division_set_id(benchmark::State& state) noexcept
+{
+    switch (state.range(0))
+    {
+    case 64:
+        return x_64;
+    case 128:
+        return x_128;
+    case 192:
+        return x_192;
+    case 256:
+        return lt_256;
+    default:
+        state.SkipWithError("unexpected argument");
+        return x_64;
+    }
+}
+
 template <typename ArgT, div_result<ArgT> DivFn(const ArgT&, const ArgT&)>
 static void div(benchmark::State& state) noexcept
 {
-    const auto division_set_id = [&state]() noexcept {
-        switch (state.range(0))
-        {
-        case 64:
-            return x_64;
-        case 128:
-            return x_128;
-        case 192:
-            return x_192;
-        case 256:
-            return lt_256;
-        default:
-            state.SkipWithError("unexpected argument");
-            return x_64;
-        }
-    }();
-
     const auto& xs = test::get_samples<ArgT>(sizeof(ArgT) == sizeof(uint256) ? x_256 : x_512);
-    const auto& ys = test::get_samples<ArgT>(division_set_id);
+    const auto& ys = test::get_samples<ArgT>(get_division_set_id(state));
 
     while (state.KeepRunningBatch(xs.size()))
     {
@@ -55,6 +57,96 @@ BENCHMARK_TEMPLATE(div, uint256, gmp::udivrem)->DenseRange(64, 256, 64);
 BENCHMARK_TEMPLATE(div, uint512, udivrem)->DenseRange(64, 256, 64);
 BENCHMARK_TEMPLATE(div, uint512, gmp::udivrem)->DenseRange(64, 256, 64);
 
+template <unsigned N>
+[[gnu::noinline]] static intx::uint<N> udivrem_quot(
+    const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    return udivrem(x, y).quot;
+}
+
+template <unsigned N>
+[[gnu::noinline]] static intx::uint<N> udivrem_rem(
+    const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    return udivrem(x, y).rem;
+}
+
+template <unsigned N>
+[[gnu::noinline]] static intx::uint<N> public_div(
+    const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    return x / y;
+}
+
+template <unsigned N>
+[[gnu::noinline]] static intx::uint<N> public_mod(
+    const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    return x % y;
+}
+
+/// The division by the word y[0]: the word-scalar kernel vs the promotion of the word to uint<N>.
+template <unsigned N>
+[[gnu::noinline]] static intx::uint<N> div_word(
+    const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    return x / y[0];
+}
+
+template <unsigned N>
+[[gnu::noinline]] static intx::uint<N> div_word_promoted(
+    const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    return x / intx::uint<N>{y[0]};
+}
+
+template <unsigned N>
+[[gnu::noinline]] static intx::uint<N> mod_word(
+    const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    return x % y[0];
+}
+
+template <unsigned N>
+[[gnu::noinline]] static intx::uint<N> mod_word_promoted(
+    const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    return x % intx::uint<N>{y[0]};
+}
+
+/// The operator/ and operator% vs the udivrem() computing both the quotient and the remainder.
+template <typename ArgT, ArgT DivFn(const ArgT&, const ArgT&)>
+static void div_op(benchmark::State& state) noexcept
+{
+    const auto& xs = test::get_samples<ArgT>(sizeof(ArgT) == sizeof(uint256) ? x_256 : x_512);
+    const auto& ys = test::get_samples<ArgT>(get_division_set_id(state));
+
+    while (state.KeepRunningBatch(xs.size()))
+    {
+        for (size_t i = 0; i < xs.size(); ++i)
+        {
+            const auto _ = DivFn(xs[i], ys[i]);
+            benchmark::DoNotOptimize(_);
+        }
+    }
+}
+BENCHMARK_TEMPLATE(div_op, uint256, udivrem_quot)->DenseRange(64, 256, 64);
+BENCHMARK_TEMPLATE(div_op, uint256, public_div)->DenseRange(64, 256, 64);
+BENCHMARK_TEMPLATE(div_op, uint256, udivrem_rem)->DenseRange(64, 256, 64);
+BENCHMARK_TEMPLATE(div_op, uint256, public_mod)->DenseRange(64, 256, 64);
+BENCHMARK_TEMPLATE(div_op, uint512, udivrem_quot)->DenseRange(64, 256, 64);
+BENCHMARK_TEMPLATE(div_op, uint512, public_div)->DenseRange(64, 256, 64);
+BENCHMARK_TEMPLATE(div_op, uint512, udivrem_rem)->DenseRange(64, 256, 64);
+BENCHMARK_TEMPLATE(div_op, uint512, public_mod)->DenseRange(64, 256, 64);
+BENCHMARK_TEMPLATE(div_op, uint256, div_word)->Arg(64);
+BENCHMARK_TEMPLATE(div_op, uint256, div_word_promoted)->Arg(64);
+BENCHMARK_TEMPLATE(div_op, uint256, mod_word)->Arg(64);
+BENCHMARK_TEMPLATE(div_op, uint256, mod_word_promoted)->Arg(64);
+BENCHMARK_TEMPLATE(div_op, uint512, div_word)->Arg(64);
+BENCHMARK_TEMPLATE(div_op, uint512, div_word_promoted)->Arg(64);
+BENCHMARK_TEMPLATE(div_op, uint512, mod_word)->Arg(64);
+BENCHMARK_TEMPLATE(div_op, uint512, mod_word_promoted)->Arg(64);
+
 
 template <uint256 ModFn(const uint256&, const uint256&, const uint256&)>
 static void mod(benchmark::State& state)
@@ -136,6 +228,34 @@ template <unsigned N>
     return intx::umul(x, y);
 }
 
+/// The operations with the word operand y[0]: the word-scalar kernels of the mixed-type operators
+/// vs the promotion of the word to uint<N>.
+template <unsigned N>
+[[gnu::noinline]] static auto add_word(const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    return x + y[0];
+}
+
+template <unsigned N>
+[[gnu::noinline]] static auto add_word_promoted(
+    const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    return x + intx::uint<N>{y[0]};
+}
+
+template <unsigned N>
+[[gnu::noinline]] static auto mul_word(const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    return x * y[0];
+}
+
+template <unsigned N>
+[[gnu::noinline]] static auto mul_word_promoted(
+    const intx::uint<N>& x, const intx::uint<N>& y) noexcept
+{
+    return x * intx::uint<N>{y[0]};
+}
+
 inline auto inline_add(const uint256& x, const uint256& y) noexcept
 {
     return x + y;
@@ -188,6 +308,10 @@ BENCHMARK_TEMPLATE(binop, uint256, uint256, sub);
 BENCHMARK_TEMPLATE(binop, uint256, uint256, inline_sub);
 BENCHMARK_TEMPLATE(binop, uint256, uint256, public_mul);
 BENCHMARK_TEMPLATE(binop, uint256, uint256, gmp::mul);
+BENCHMARK_TEMPLATE(binop, uint256, uint256, add_word);
+BENCHMARK_TEMPLATE(binop, uint256, uint256, add_word_promoted);
+BENCHMARK_TEMPLATE(binop, uint256, uint256, mul_word);
+BENCHMARK_TEMPLATE(binop, uint256, uint256, mul_word_promoted);
 
 BENCHMARK_TEMPLATE(binop, uint512, uint256, umul_);
 BENCHMARK_TEMPLATE(binop, uint512, uint256, gmp::mul_full);
@@ -198,6 +322,64 @@ BENCHMARK_TEMPLATE(binop, uint512, uint512, sub);
 BENCHMARK_TEMPLATE(binop, uint512, uint512, inline_sub);
 BENCHMARK_TEMPLATE(binop, uint512, uint512, public_mul);
 BENCHMARK_TEMPLATE(binop, uint512, uint512, gmp::mul);
+BENCHMARK_TEMPLATE(binop, uint512, uint512, add_word);
+BENCHMARK_TEMPLATE(binop, uint512, uint512, add_word_promoted);
+BENCHMARK_TEMPLATE(binop, uint512, uint512, mul_word);
+BENCHMARK_TEMPLATE(binop, uint512, uint512, mul_word_promoted);
+
+template <unsigned N>
+[[gnu::noinline]] static auto umul_add_public(
+    const intx::uint<N>& x, const intx::uint<N>& y, const intx::uint<N>& z) noexcept
+{
+    return intx::umul_add(x, y, z);
+}
+
+template <unsigned N>
+[[gnu::noinline]] static auto umul_add_composed(
+    const intx::uint<N>& x, const intx::uint<N>& y, const intx::uint<N>& z) noexcept
+{
+    return intx::umul(x, y) + intx::uint<2 * N>{z};
+}
+
+template <unsigned N>
+[[gnu::noinline]] static auto mul_add_public(
+    const intx::uint<N>& x, const intx::uint<N>& y, const intx::uint<N>& z) noexcept
+{
+    return intx::mul_add(x, y, z);
+}
+
+template <unsigned N>
+[[gnu::noinline]] static auto mul_add_composed(
+    const intx::uint<N>& x, const intx::uint<N>& y, const intx::uint<N>& z) noexcept
+{
+    return x * y + z;
+}
+
+template <typename ResultT, typename ArgT,
+    ResultT TernOp(const ArgT&, const ArgT&, const ArgT&)>
+static void ternop(benchmark::State& state)
+{
+    const auto& xs = test::get_samples<ArgT>(sizeof(ArgT) == sizeof(uint256) ? x_256 : x_512);
+    const auto& ys = test::get_samples<ArgT>(sizeof(ArgT) == sizeof(uint256) ? y_256 : y_512);
+    const auto& zs = test::get_samples<ArgT>(lt_256);
+
+    while (state.KeepRunningBatch(test::num_samples))
+    {
+        for (size_t i = 0; i < test::num_samples; ++i)
+        {
+            const auto _ = TernOp(xs[i], ys[i], zs[i]);
+            benchmark::DoNotOptimize(_);
+        }
+    }
+}
+BENCHMARK_TEMPLATE(ternop, uint512, uint256, umul_add_public);
+BENCHMARK_TEMPLATE(ternop, uint512, uint256, umul_add_composed);
+BENCHMARK_TEMPLATE(ternop, uint256, uint256, mul_add_public);
+BENCHMARK_TEMPLATE(ternop, uint256, uint256, mul_add_composed);
+BENCHMARK_TEMPLATE(ternop, intx::uint<1024>, uint512, umul_add_public);
+BENCHMARK_TEMPLATE(ternop, intx::uint<1024>, uint512, umul_add_composed);
+BENCHMARK_TEMPLATE(ternop, uint512, uint512, mul_add_public);
+BENCHMARK_TEMPLATE(ternop, uint512, uint512, mul_add_composed);
 
 template <unsigned N>
 [[gnu::noinline]] static intx::uint<N> shl_public(
@@ -520,5 +702,3 @@ static void to_string(benchmark::State& state)
 BENCHMARK_TEMPLATE(to_string, uint128);
 BENCHMARK_TEMPLATE(to_string, uint256);
 BENCHMARK_TEMPLATE(to_string, uint512);
-
-BENCHMARK_MAIN();
@@ -0,0 +1,256 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+/// @file
+/// The main of intx-bench with the options for the stable measurements without root privileges.
+///
+/// Options (in addition to the Google Benchmark ones):
+///   --pin_cpu=<n>      Pins the process to the CPU n (Linux).
+///   --warmup=<s>       Runs the busy loop up to s seconds until the CPU frequency is stable
+///                      (default 0.5).
+///   --max_cv=<x>       Re-runs the benchmarks with the coefficient of variation of the repetitions
+///                      greater than x (e.g. 0.02). If some stay noisy, lists them as rejected
+///                      and exits with the code 2: their results must not be used.
+///                      Enables 5 repetitions unless --benchmark_repetitions is given.
+///   --max_reruns=<k>   The number of the re-runs of the noisy benchmarks (default 2).
+///   --corpus=<dir>     Registers the benchmarks replaying the fuzz_intx corpus (bench_corpus.cpp).
+///
+/// The CPU frequency is estimated with the loop of known latency before and after the run
+/// (x86-64 only). The change by more than 2% is reported as the frequency drift.
+
+#include <benchmark/benchmark.h>
+#include <test/utils/options.hpp>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+    #include <sched.h>
+#endif
+
+bool register_corpus_benchmarks(const std::string& dir);
+
+using namespace intx::test;
+
+namespace
+{
+bool pin_to_cpu(size_t cpu)
+{
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+/// The CPU frequency estimate.
+struct frequency
+{
+    double core_ghz = 0;  ///< The core clock measured with the loop of 1 cycle per iteration.
+    double tsc_ghz = 0;   ///< The time-stamp counter rate.
+};
+
+/// Estimates the frequency by the loop of the macro-fused dec+jnz pairs executed at
+/// 1 iteration per cycle. Returns zeros if not supported.
+frequency measure_frequency()
+{
+#if defined(__x86_64__) && defined(__GNUC__)
+    constexpr uint64_t num_iterations = 20'000'000;
+
+    const auto tsc_start = __builtin_ia32_rdtsc();
+    const auto start = std::chrono::steady_clock::now();
+    auto n = num_iterations;
+    asm volatile("1: dec %0\n\tjnz 1b" : "+r"(n));
+    const auto end = std::chrono::steady_clock::now();
+    const auto tsc_end = __builtin_ia32_rdtsc();
+
+    const auto ns = std::chrono::duration<double, std::nano>(end - start).count();
+    const auto num_ticks = static_cast<double>(tsc_end - tsc_start);
+    return {static_cast<double>(num_iterations) / ns, num_ticks / ns};
+#else
+    return {};
+#endif
+}
+
+/// Runs the frequency measurement until two consecutive estimates differ by less than 0.5%
+/// or the time limit is reached.
+frequency warm_up(double max_seconds)
+{
+    const auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::duration<double>(max_seconds);
+    auto prev = measure_frequency();
+    while (std::chrono::steady_clock::now() < deadline)
+    {
+        const auto f = measure_frequency();
+        if (f.core_ghz == 0 || std::abs(f.core_ghz - prev.core_ghz) < 0.005 * prev.core_ghz)
+            return f;
+        prev = f;
+    }
+    std::cerr << "warm-up: the CPU frequency not stable after " << max_seconds << " s\n";
+    return prev;
+}
+
+std::ostream& operator<<(std::ostream& out, const frequency& f)
+{
+    return out << "core " << f.core_ghz << " GHz, TSC " << f.tsc_ghz << " GHz, core/TSC "
+               << f.core_ghz / f.tsc_ghz;
+}
+
+/// Escapes the regex special characters of the benchmark name.
+std::string escape_regex(const std::string& s)
+{
+    std::string r;
+    for (const auto c : s)
+    {
+        if (std::string{".[]{}()\\*+?|^$"}.find(c) != std::string::npos)
+            r += '\\';
+        r += c;
+    }
+    return r;
+}
+
+/// Passes the results to the console reporter and computes the coefficient of variation
+/// of the repetitions of each benchmark.
+class cv_reporter : public benchmark::ConsoleReporter
+{
+public:
+    std::map<std::string, double> cvs;
+
+    void ReportRuns(const std::vector<Run>& runs) override
+    {
+        ConsoleReporter::ReportRuns(runs);
+
+        std::map<std::string, std::vector<double>> times;
+        for (const auto& run : runs)
+        {
+            if (!run.error_occurred && run.run_type == Run::RT_Iteration)
+                times[run.run_name.str()].push_back(run.GetAdjustedRealTime());
+        }
+
+        for (const auto& [name, ts] : times)
+        {
+            if (ts.size() < 2)
+                continue;
+            double mean = 0;
+            for (const auto t : ts)
+                mean += t;
+            mean /= static_cast<double>(ts.size());
+            double var = 0;
+            for (const auto t : ts)
+                var += (t - mean) * (t - mean);
+            var /= static_cast<double>(ts.size() - 1);
+            cvs[name] = std::sqrt(var) / mean;
+        }
+    }
+};
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    const auto pin_cpu = take_option(argc, argv, "pin_cpu");
+    const auto warmup = take_option(argc, argv, "warmup");
+    const auto max_cv_str = take_option(argc, argv, "max_cv");
+    const auto max_reruns_str = take_option(argc, argv, "max_reruns");
+    const auto corpus_dir = take_option(argc, argv, "corpus");
+
+    std::vector<char*> args(argv, argv + argc);
+    std::string repetitions_arg = "--benchmark_repetitions=5";
+    if (!max_cv_str.empty() && !has_option(argc, argv, "benchmark_repetitions"))
+        args.push_back(repetitions_arg.data());
+    auto num_args = static_cast<int>(args.size());
+
+    benchmark::Initialize(&num_args, args.data());
+    if (benchmark::ReportUnrecognizedArguments(num_args, args.data()))
+        return 1;
+
+    if (!corpus_dir.empty() && !register_corpus_benchmarks(corpus_dir))
+        return 1;
+
+    if (!pin_cpu.empty())
+    {
+        if (!pin_to_cpu(std::stoul(pin_cpu)))
+        {
+            std::cerr << "cannot pin to CPU " << pin_cpu << '\n';
+            return 1;
+        }
+        std::cerr << "pinned to CPU " << pin_cpu << '\n';
+    }
+
+    // The baseline frequency is taken after the warm-up, otherwise on the cold CPU
+    // the drift is reported spuriously.
+    const auto freq_before = warm_up(warmup.empty() ? 0.5 : std::stod(warmup));
+    if (freq_before.core_ghz != 0)
+        std::cerr << "frequency before: " << freq_before << '\n';
+
+    cv_reporter reporter;
+    benchmark::RunSpecifiedBenchmarks(&reporter);
+
+    int num_rejected = 0;
+    if (!max_cv_str.empty())
+    {
+        const auto max_cv = std::stod(max_cv_str);
+        const auto max_reruns = max_reruns_str.empty() ? 2 : std::stoi(max_reruns_str);
+        for (int i = 0;; ++i)
+        {
+            std::string spec;
+            for (const auto& [name, cv] : reporter.cvs)
+            {
+                if (cv > max_cv)
+                    spec += (spec.empty() ? "" : "|") + escape_regex(name);
+            }
+            if (spec.empty())
+                break;
+
+            if (i == max_reruns)
+            {
+                for (const auto& [name, cv] : reporter.cvs)
+                {
+                    if (cv > max_cv)
+                    {
+                        std::cerr << "rejected (cv " << cv << "): " << name << '\n';
+                        ++num_rejected;
+                    }
+                }
+                break;
+            }
+
+            std::cerr << "re-running noisy benchmarks (" << i + 1 << "/" << max_reruns << ")\n";
+            // Select the benchmarks by parsing the filter option again. The overload
+            // of RunSpecifiedBenchmarks() with the filter requires benchmark 1.7.0.
+            std::string filter_arg = "--benchmark_filter=^(" + spec + ")$";
+            std::array<char*, 2> rerun_args{argv[0], filter_arg.data()};
+            auto num_rerun_args = static_cast<int>(rerun_args.size());
+            benchmark::Initialize(&num_rerun_args, rerun_args.data());
+            benchmark::RunSpecifiedBenchmarks(&reporter);
+        }
+    }
+
+    const auto freq_after = measure_frequency();
+    if (freq_after.core_ghz != 0)
+    {
+        std::cerr << "frequency after: " << freq_after << '\n';
+        const auto ratio_before = freq_before.core_ghz / freq_before.tsc_ghz;
+        const auto ratio_after = freq_after.core_ghz / freq_after.tsc_ghz;
+        if (std::abs(ratio_after - ratio_before) > 0.02 * ratio_before)
+            std::cerr << "frequency drift detected: the results may be unreliable\n";
+    }
+
+    benchmark::Shutdown();
+
+    if (num_rejected != 0)
+    {
+        std::cerr << num_rejected << " benchmarks rejected as noisy\n";
+        return 2;
+    }
+    return 0;
+}
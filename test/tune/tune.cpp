@@ -0,0 +1,170 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+/// @file
+/// The tool measuring the crossover points of the intx algorithms on the host CPU.
+///
+/// Writes the thresholds to the intx_tuning.hpp header (or the file given as the argument).
+/// To apply them configure intx with -DINTX_TUNING_HEADER=<path to the header>
+/// or define INTX_TUNING_HEADER to the quoted header name for all files using intx.
+
+#include <intx/algorithm.hpp>
+#include <test/utils/random.hpp>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <map>
+
+using namespace intx;
+using namespace intx::test;
+
+namespace
+{
+/// Returns the min over repetitions of the time per operation in ns.
+template <typename Fn>
+double measure(Fn&& fn, size_t num_ops)
+{
+    constexpr int num_repetitions = 15;
+
+    auto best = std::numeric_limits<double>::max();
+    for (int i = 0; i < num_repetitions; ++i)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        fn();
+        const auto end = std::chrono::steady_clock::now();
+        const auto ns = std::chrono::duration<double, std::nano>(end - start).count();
+        best = std::min(best, ns / static_cast<double>(num_ops));
+    }
+    return best;
+}
+
+volatile uint64_t sink;
+
+/// Finds the min numerator length for which the division by the word with the reciprocal
+/// is faster than the hardware division.
+unsigned tune_divrem_1()
+{
+#if INTX_HAS_HW_DIV_2BY1
+    constexpr unsigned max_words = uint512::num_words;
+    constexpr size_t num_passes = 64;
+
+    lcg<uint512> rng(get_seed());
+    lcg<uint64_t> rng_word(get_seed());
+    std::vector<uint64_t> ds(num_samples);
+    for (auto& d : ds)
+        d = rng_word() >> (rng_word() % 64) | 1;
+
+    for (unsigned n = 1; n <= max_words; ++n)
+    {
+        std::vector<uint512> xs(num_samples);
+        for (auto& x : xs)
+            x = (rng() >> ((max_words - n) * 64)) | (uint512{1} << (n * 64 - 1));
+
+        const auto run = [&](auto divrem_fn) {
+            return measure(
+                [&] {
+                    uint64_t acc = 0;
+                    for (size_t p = 0; p < num_passes; ++p)
+                    {
+                        for (size_t i = 0; i < num_samples; ++i)
+                        {
+                            const auto res = divrem_fn(xs[i], n, ds[i]);
+                            acc ^= res.quot[0] ^ res.rem;
+                        }
+                    }
+                    sink = acc;
+                },
+                num_passes * num_samples);
+        };
+        const auto t_hw = run(internal::divrem_1_hw<512>);
+        const auto t_reciprocal = run(internal::divrem_1_reciprocal<512>);
+
+        std::cout << "divrem_1  words: " << n << "  hw: " << t_hw
+                  << " ns  reciprocal: " << t_reciprocal << " ns\n";
+        if (t_reciprocal < t_hw)
+            return n;
+    }
+    return max_words + 1;
+#else
+    std::cout << "divrem_1  the hardware division not available\n";
+    return INTX_DIVREM_1_RECIPROCAL_THRESHOLD;
+#endif
+}
+
+template <ptrdiff_t Threshold>
+double measure_equal_range(const std::vector<uint256>& values, const std::vector<uint256>& queries)
+{
+    return measure(
+        [&] {
+            size_t acc = 0;
+            for (const auto& q : queries)
+            {
+                const auto [lo, hi] = internal::equal_range<Threshold>(
+                    values.data(), values.data() + values.size(), q);
+                acc += static_cast<size_t>(hi - lo);
+            }
+            sink = acc;
+        },
+        queries.size());
+}
+
+/// Finds the range length below which equal_range() scans linearly in the shortest time
+/// for ranges of different sizes.
+unsigned tune_equal_range()
+{
+    lcg<uint256> rng(get_seed());
+    std::map<unsigned, double> times;
+    for (const size_t size : {size_t{1} << 8, size_t{1} << 12, size_t{1} << 16})
+    {
+        std::vector<uint256> values(size);
+        for (auto& v : values)
+            v = rng();
+        std::sort(values.begin(), values.end());
+
+        std::vector<uint256> queries(1024);
+        for (size_t i = 0; i < queries.size(); ++i)
+            queries[i] = (i % 2 == 0) ? values[(i * 7919) % size] : rng();
+
+        times[1] += measure_equal_range<1>(values, queries);
+        times[2] += measure_equal_range<2>(values, queries);
+        times[4] += measure_equal_range<4>(values, queries);
+        times[8] += measure_equal_range<8>(values, queries);
+        times[16] += measure_equal_range<16>(values, queries);
+        times[32] += measure_equal_range<32>(values, queries);
+        times[64] += measure_equal_range<64>(values, queries);
+    }
+
+    auto best = times.begin();
+    for (auto it = times.begin(); it != times.end(); ++it)
+    {
+        std::cout << "equal_range  linear scan threshold: " << it->first << "  " << it->second
+                  << " ns\n";
+        if (it->second < best->second)
+            best = it;
+    }
+    return best->first;
+}
+}  // namespace
+
+int main(int argc, char** argv)
+{
+    const std::string path = argc > 1 ? argv[1] : "intx_tuning.hpp";
+
+    const auto divrem_1_threshold = tune_divrem_1();
+    const auto equal_range_threshold = tune_equal_range();
+
+    std::ofstream out{path};
+    out << "// The intx algorithm thresholds for the host CPU. Generated by intx-tune.\n\n"
+        << "#pragma once\n\n"
+        << "#define INTX_DIVREM_1_RECIPROCAL_THRESHOLD " << divrem_1_threshold << '\n'
+        << "#define INTX_EQUAL_RANGE_LINEAR_THRESHOLD " << equal_range_threshold << '\n';
+    if (!out)
+    {
+        std::cerr << "cannot write " << path << '\n';
+        return 1;
+    }
+    std::cout << "written " << path << '\n';
+    return 0;
+}
@@ -0,0 +1,133 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include "test_suite.hpp"
+#include <intx/algorithm.hpp>
+#include <test/utils/random.hpp>
+#include <vector>
+
+using namespace intx;
+
+#ifdef INTX_TEST_AVX2
+static_assert(INTX_HAS_AVX2, "the AVX2 path is not enabled");
+#endif
+
+namespace
+{
+template <typename Int>
+std::vector<Int> gen_values(size_t n)
+{
+    // Mix of values of different widths, to check both the top word and lower words decisions.
+    test::lcg<Int> rng(test::get_seed());
+    std::vector<Int> values(n);
+    for (auto& v : values)
+    {
+        v = rng();
+        v >>= v[0] % Int::num_bits;
+    }
+    return values;
+}
+}  // namespace
+
+TYPED_TEST(uint_test, algorithm_compare)
+{
+    const auto values = gen_values<TypeParam>(100);
+    for (const auto& x : values)
+    {
+        for (const auto& y : values)
+        {
+            const auto c = internal::compare(x, y);
+            EXPECT_EQ(c < 0, x < y);
+            EXPECT_EQ(c == 0, x == y);
+            EXPECT_EQ(c > 0, x > y);
+        }
+    }
+
+    const auto max = ~TypeParam{0};
+    const auto top = TypeParam{1} << (TypeParam::num_bits - 1);
+    EXPECT_LT(internal::compare(top, max), 0);
+    EXPECT_GT(internal::compare(max, top), 0);
+    EXPECT_EQ(internal::compare(max, max), 0);
+    EXPECT_LT(internal::compare(TypeParam{0}, TypeParam{1}), 0);
+    EXPECT_GT(internal::compare(TypeParam{1} << 64, TypeParam{~uint64_t{0}}), 0);
+}
+
+TYPED_TEST(uint_test, algorithm_find_first_ge)
+{
+    const auto values = gen_values<TypeParam>(200);
+    const auto first = values.data();
+    const auto last = first + values.size();
+
+    for (const auto& threshold : values)
+    {
+        const auto expected =
+            std::find_if(first, last, [&](const TypeParam& x) { return x >= threshold; });
+        EXPECT_EQ(find_first_ge(first, last, threshold), expected);
+    }
+
+    EXPECT_EQ(find_first_ge(first, last, ~TypeParam{0}), last);
+    EXPECT_EQ(find_first_ge(first, first, TypeParam{0}), first);
+}
+
+TYPED_TEST(uint_test, algorithm_count_ge)
+{
+    const auto values = gen_values<TypeParam>(200);
+    const auto first = values.data();
+    const auto last = first + values.size();
+
+    for (const auto& threshold : values)
+    {
+        const auto expected = static_cast<size_t>(
+            std::count_if(first, last, [&](const TypeParam& x) { return x >= threshold; }));
+        EXPECT_EQ(count_ge(first, last, threshold), expected);
+    }
+
+    EXPECT_EQ(count_ge(first, last, TypeParam{0}), values.size());
+    EXPECT_EQ(count_ge(first, first, TypeParam{0}), 0u);
+}
+
+TYPED_TEST(uint_test, algorithm_min_max_element)
+{
+    auto values = gen_values<TypeParam>(200);
+    values.push_back(values[17]);  // Duplicates: the first occurrence is expected.
+    values.push_back(values[42]);
+    const auto first = values.data();
+    const auto last = first + values.size();
+
+    EXPECT_EQ(intx::min_element(first, last), std::min_element(first, last));
+    EXPECT_EQ(intx::max_element(first, last), std::max_element(first, last));
+    EXPECT_EQ(intx::min_element(first, first), first);
+    EXPECT_EQ(intx::max_element(first, first), first);
+    EXPECT_EQ(intx::min_element(first, first + 1), first);
+    EXPECT_EQ(intx::max_element(first, first + 1), first);
+}
+
+TYPED_TEST(uint_test, algorithm_equal_range)
+{
+    auto values = gen_values<TypeParam>(100);
+    const auto num_unique = values.size();
+    for (size_t i = 0; i < num_unique; i += 3)
+        values.insert(values.end(), i % 20, values[i]);
+    std::sort(values.begin(), values.end());
+    const auto first = values.data();
+    const auto last = first + values.size();
+
+    for (const auto& x : values)
+    {
+        const auto expected = std::equal_range(first, last, x);
+        const auto r = intx::equal_range(first, last, x);
+        EXPECT_EQ(r.first, expected.first);
+        EXPECT_EQ(r.second, expected.second);
+
+        const auto next = x + 1;
+        const auto expected_next = std::equal_range(first, last, next);
+        const auto r_next = intx::equal_range(first, last, next);
+        EXPECT_EQ(r_next.first, expected_next.first);
+        EXPECT_EQ(r_next.second, expected_next.second);
+    }
+
+    const auto empty = intx::equal_range(first, first, TypeParam{1});
+    EXPECT_EQ(empty.first, first);
+    EXPECT_EQ(empty.second, first);
+}
@@ -0,0 +1,101 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include "test_suite.hpp"
+#include <intx/aligned.hpp>
+#include <vector>
+
+using namespace intx;
+
+static_assert(alignof(aligned_uint256) == 32);
+static_assert(sizeof(aligned_uint256) == sizeof(uint256));
+static_assert(alignof(aligned_uint512) == 64);
+static_assert(sizeof(aligned_uint512) == sizeof(uint512));
+static_assert(alignof(aligned_uint<192>) == 32);
+static_assert(sizeof(aligned_uint<192>) == 32);
+static_assert(alignof(aligned_uint<128, 64>) == 64);
+
+static_assert(aligned_uint256{2} + aligned_uint256{3} == 5);
+static_assert(aligned_uint256{7} * 6 == 42);
+static_assert(aligned_uint<128>{1, 1} == uint128{1, 1});
+
+namespace
+{
+uint256 pass_by_uint(const uint256& x) noexcept
+{
+    return x + 1;
+}
+
+template <typename T>
+bool is_aligned(const T* p, size_t alignment) noexcept
+{
+    return reinterpret_cast<uintptr_t>(p) % alignment == 0;
+}
+}  // namespace
+
+TYPED_TEST(uint_test, aligned_uint_operators)
+{
+    using AlignedT = aligned_uint<TypeParam::num_bits, 64>;
+
+    const auto x = TypeParam{1} << (TypeParam::num_bits - 1);
+    const auto y = TypeParam{3};
+
+    const AlignedT ax = x;
+    const AlignedT ay = y;
+    AlignedT az;
+
+    EXPECT_EQ(ax, x);
+    EXPECT_EQ(ax + ay, x + y);
+    EXPECT_EQ(ax - ay, x - y);
+    EXPECT_EQ(ax * ay, x * y);
+    EXPECT_EQ(ax / ay, x / y);
+    EXPECT_EQ(ax % ay, x % y);
+    EXPECT_EQ(ax ^ ay, x ^ y);
+    EXPECT_EQ(ax >> 3, x >> 3);
+    EXPECT_EQ(ay << ay, y << y);
+    EXPECT_EQ(ax + y, x + y);
+    EXPECT_EQ(x - ay, x - y);
+    EXPECT_EQ(ax + 1, x + 1);
+    EXPECT_EQ(1 + ax, 1 + x);
+    EXPECT_LT(ay, ax);
+    EXPECT_GT(ax, y);
+    EXPECT_NE(ax, 0);
+    EXPECT_EQ(0, az);
+
+    az = ax * ay;
+    az += ay;
+    az <<= 1;
+    EXPECT_EQ(az, (x * y + y) << 1);
+}
+
+TEST(aligned, interchangeable)
+{
+    aligned_uint256 x = 41;
+    EXPECT_EQ(pass_by_uint(x), 42);
+    x = pass_by_uint(x);
+    EXPECT_EQ(x, 42);
+
+    uint8_t bytes[32]{};
+    be::store(bytes, static_cast<const uint256&>(x));
+    EXPECT_EQ(bytes[31], 42);
+    EXPECT_EQ(be::load<uint256>(bytes), x);
+}
+
+TEST(aligned, vector_allocator)
+{
+    std::vector<uint256, aligned_allocator<uint256>> v(100, uint256{7});
+    EXPECT_TRUE(is_aligned(v.data(), 64));
+    v.resize(1000);
+    EXPECT_TRUE(is_aligned(v.data(), 64));
+    EXPECT_EQ(v[99], 7);
+    EXPECT_EQ(v[100], 0);
+
+    std::vector<aligned_uint<192>, aligned_allocator<aligned_uint<192>, 128>> w(10);
+    EXPECT_TRUE(is_aligned(w.data(), 128));
+    for (const auto& e : w)
+        EXPECT_TRUE(is_aligned(&e, 32));
+
+    EXPECT_TRUE(aligned_allocator<uint256>{} == aligned_allocator<uint512>{});
+    EXPECT_FALSE(aligned_allocator<uint256>{} != aligned_allocator<uint512>{});
+}
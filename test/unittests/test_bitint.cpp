@@ -0,0 +1,76 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+/// @file
+/// The checks of the unsigned _BitInt(N) backend of the uint<N> operators.
+/// Built into intx-unittests-bitint with all INTX_BITINT_* options enabled
+/// for the whole target, together with the uint_test suite.
+
+#include "test_suite.hpp"
+#include <array>
+
+#if !INTX_HAS_BITINT || !INTX_BITINT_ADD || !INTX_BITINT_CMP || !INTX_BITINT_SHIFT || \
+    !INTX_BITINT_MUL
+    #error "the _BitInt backend is not enabled"
+#endif
+
+using namespace intx;
+
+namespace
+{
+template <typename T>
+constexpr T a = ~T{} - 0x1234;
+
+template <typename T>
+constexpr T b = (T{0xfedcba9876543210} << (T::num_bits / 2)) | 0x5555;
+
+template <typename T>
+constexpr std::array<uint64_t, 9> shifts{
+    0, 1, 63, 64, 65, T::num_bits / 2, T::num_bits - 1, T::num_bits, T::num_bits + 1};
+}  // namespace
+
+static_assert(internal::has_bitint<128>);
+
+// The constant evaluation uses the portable implementations, the run time the _BitInt backend
+// (for N <= __BITINT_MAXWIDTH__, e.g. 128 in Clang 14).
+TYPED_TEST(uint_test, bitint_backend_vs_constexpr)
+{
+    constexpr auto ca = a<TypeParam>;
+    constexpr auto cb = b<TypeParam>;
+    constexpr auto sum = ca + cb;
+    constexpr auto diff = cb - ca;
+    constexpr auto prod = ca * cb;
+    constexpr auto eq = ca == cb;
+    constexpr auto lt = cb < ca;
+
+    const auto x = ca;
+    const auto y = cb;
+    EXPECT_EQ(x + y, sum);
+    EXPECT_EQ(y - x, diff);
+    EXPECT_EQ(x * y, prod);
+    EXPECT_EQ(x == y, eq);
+    const auto x_copy = x;
+    EXPECT_EQ(x == x_copy, true);
+    EXPECT_EQ(y < x, lt);
+    EXPECT_EQ(x < y, false);
+
+    constexpr auto s = shifts<TypeParam>;
+    constexpr auto shl = [] {
+        std::array<TypeParam, shifts<TypeParam>.size()> r{};
+        for (size_t i = 0; i < r.size(); ++i)
+            r[i] = a<TypeParam> << shifts<TypeParam>[i];
+        return r;
+    }();
+    constexpr auto shr = [] {
+        std::array<TypeParam, shifts<TypeParam>.size()> r{};
+        for (size_t i = 0; i < r.size(); ++i)
+            r[i] = a<TypeParam> >> shifts<TypeParam>[i];
+        return r;
+    }();
+    for (size_t i = 0; i < s.size(); ++i)
+    {
+        EXPECT_EQ(x << s[i], shl[i]) << s[i];
+        EXPECT_EQ(x >> s[i], shr[i]) << s[i];
+    }
+}
@@ -273,3 +273,22 @@ TEST(builtins, le_store_uint32_t)
     le::unsafe::store(data, uint32_t{0xc1c2c3c4});
     EXPECT_EQ(view, "\xc4\xc3\xc2\xc1");
 }
+
+#if INTX_HAS_BUILTIN_INT128
+TEST(builtins, le_load_store_builtin_uint128)
+{
+    const uint8_t data[] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+        0x0c, 0x0d, 0x0e, 0x0f, 0x10};
+    const auto x = le::load<builtin_uint128>(data);
+    EXPECT_EQ(uint64_t(x), 0x0807060504030201);
+    EXPECT_EQ(uint64_t(x >> 64), 0x100f0e0d0c0b0a09);
+    EXPECT_EQ(le::unsafe::load<builtin_uint128>(data), x);
+
+    uint8_t out[sizeof(x)]{};
+    le::store(out, x);
+    EXPECT_TRUE(std::equal(std::begin(out), std::end(out), std::begin(data)));
+    std::fill_n(out, std::size(out), uint8_t{0});
+    le::unsafe::store(out, x);
+    EXPECT_TRUE(std::equal(std::begin(out), std::end(out), std::begin(data)));
+}
+#endif
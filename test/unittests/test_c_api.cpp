@@ -0,0 +1,159 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include <gtest/gtest.h>
+#include <intx/intx.hpp>
+#include <intx_c.h>
+#include <test/utils/random.hpp>
+
+using namespace intx;
+
+namespace
+{
+template <typename T>
+auto load(const T& t) noexcept
+{
+    return le::load<intx::uint<sizeof(t.bytes) * 8>>(t.bytes);
+}
+
+template <typename T, unsigned N>
+T store(const intx::uint<N>& x) noexcept
+{
+    T t;
+    le::store(t.bytes, x);
+    return t;
+}
+
+template <typename T>
+std::vector<T> gen_values()
+{
+    constexpr auto N = sizeof(T{}.bytes) * 8;
+    test::lcg<intx::uint<N>> rng(test::get_seed());
+    std::vector<T> values{store<T>(intx::uint<N>{0}), store<T>(intx::uint<N>{1}),
+        store<T>(~intx::uint<N>{}), store<T>(intx::uint<N>{~uint64_t{0}})};
+    for (unsigned i = 0; i < 60; ++i)
+        values.push_back(store<T>(rng() >> (i * 7 % N)));
+    return values;
+}
+}  // namespace
+
+TEST(c_api, arithmetic_256)
+{
+    const auto a = gen_values<intx_uint256>();
+    auto b = a;
+    std::reverse(b.begin(), b.end());
+    const auto n = a.size();
+    const auto mod = store<intx_uint256>(0xfffffffffffffffffffffffffffffffeffffffffffffffff_u256);
+
+    std::vector<intx_uint256> sum(n), diff(n), prod(n), prodmod(n);
+    intx_add_n(sum.data(), a.data(), b.data(), n);
+    intx_sub_n(diff.data(), a.data(), b.data(), n);
+    intx_mul_n(prod.data(), a.data(), b.data(), n);
+    intx_mulmod_n(prodmod.data(), a.data(), b.data(), &mod, n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        const auto x = load(a[i]);
+        const auto y = load(b[i]);
+        EXPECT_EQ(load(sum[i]), x + y);
+        EXPECT_EQ(load(diff[i]), x - y);
+        EXPECT_EQ(load(prod[i]), x * y);
+        EXPECT_EQ(load(prodmod[i]), mulmod(x, y, load(mod)));
+    }
+
+    const auto zero = store<intx_uint256>(uint256{0});
+    intx_mulmod_n(prodmod.data(), a.data(), b.data(), &zero, n);
+    for (const auto& r : prodmod)
+        EXPECT_EQ(load(r), 0);
+
+    // The results alias the arguments.
+    auto r = a;
+    intx_add_n(r.data(), r.data(), r.data(), n);
+    for (size_t i = 0; i < n; ++i)
+        EXPECT_EQ(load(r[i]), load(a[i]) << 1);
+}
+
+TEST(c_api, arithmetic_512)
+{
+    const auto a = gen_values<intx_uint512>();
+    auto b = a;
+    std::reverse(b.begin(), b.end());
+    const auto n = a.size();
+
+    std::vector<intx_uint512> sum(n), diff(n), prod(n);
+    intx_add512_n(sum.data(), a.data(), b.data(), n);
+    intx_sub512_n(diff.data(), a.data(), b.data(), n);
+    intx_mul512_n(prod.data(), a.data(), b.data(), n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        const auto x = load(a[i]);
+        const auto y = load(b[i]);
+        EXPECT_EQ(load(sum[i]), x + y);
+        EXPECT_EQ(load(diff[i]), x - y);
+        EXPECT_EQ(load(prod[i]), x * y);
+    }
+}
+
+TEST(c_api, dec_256)
+{
+    const auto a = gen_values<intx_uint256>();
+    const auto n = a.size();
+
+    std::vector<char> dec(n * INTX_UINT256_DEC_SIZE);
+    intx_to_dec_n(dec.data(), a.data(), n);
+    std::vector<intx_uint256> r(n);
+    EXPECT_EQ(intx_from_dec_n(r.data(), dec.data(), n), n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        EXPECT_EQ(&dec[i * INTX_UINT256_DEC_SIZE], to_string(load(a[i])));
+        EXPECT_EQ(load(r[i]), load(a[i]));
+    }
+}
+
+TEST(c_api, dec_512)
+{
+    const auto a = gen_values<intx_uint512>();
+    const auto n = a.size();
+
+    std::vector<char> dec(n * INTX_UINT512_DEC_SIZE);
+    intx_to_dec512_n(dec.data(), a.data(), n);
+    std::vector<intx_uint512> r(n);
+    EXPECT_EQ(intx_from_dec512_n(r.data(), dec.data(), n), n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        EXPECT_EQ(&dec[i * INTX_UINT512_DEC_SIZE], to_string(load(a[i])));
+        EXPECT_EQ(load(r[i]), load(a[i]));
+    }
+}
+
+TEST(c_api, from_dec_invalid)
+{
+    const char* inputs[] = {
+        "0",
+        "000000000000000000000000000000000000000000000000000000000000000000000000000012",
+        "115792089237316195423570985008687907853269984665640564039457584007913129639935",
+        "115792089237316195423570985008687907853269984665640564039457584007913129639936",
+        "",
+        "12a",
+        "-1",
+    };
+    constexpr size_t num_valid = 3;
+
+    std::vector<char> dec(std::size(inputs) * INTX_UINT256_DEC_SIZE);
+    for (size_t i = 0; i < std::size(inputs); ++i)
+        std::strcpy(&dec[i * INTX_UINT256_DEC_SIZE], inputs[i]);
+
+    std::vector<intx_uint256> r(std::size(inputs));
+    EXPECT_EQ(intx_from_dec_n(r.data(), dec.data(), std::size(inputs)), num_valid);
+    EXPECT_EQ(load(r[0]), 0);
+    EXPECT_EQ(load(r[1]), 12);
+    EXPECT_EQ(load(r[2]), ~uint256{});
+    for (size_t i = num_valid; i < std::size(inputs); ++i)
+    {
+        EXPECT_EQ(intx_from_dec_n(r.data(), &dec[i * INTX_UINT256_DEC_SIZE], 1), 0) << inputs[i];
+    }
+
+    // The string not terminated within the slot.
+    std::fill_n(dec.begin(), INTX_UINT256_DEC_SIZE, '1');
+    EXPECT_EQ(intx_from_dec_n(r.data(), dec.data(), 1), 0);
+}
@@ -331,6 +331,8 @@ TEST(div, udivrem_512)
         auto res = udivrem(t.numerator, t.denominator);
         EXPECT_EQ(res.quot, t.quotient);
         EXPECT_EQ(res.rem, t.reminder);
+        EXPECT_EQ(udiv(t.numerator, t.denominator), t.quotient);
+        EXPECT_EQ(umod(t.numerator, t.denominator), t.reminder);
     }
 }
 
@@ -361,6 +363,10 @@ TEST(div, udivrem_256)
         const auto [quot, rem] = udivrem(n, d);
         EXPECT_EQ(quot, t.quotient);
         EXPECT_EQ(rem, t.reminder);
+        EXPECT_EQ(udiv(n, d), t.quotient);
+        EXPECT_EQ(umod(n, d), t.reminder);
+        EXPECT_EQ(n / d, t.quotient);
+        EXPECT_EQ(n % d, t.reminder);
     }
 }
 
@@ -390,6 +396,8 @@ TEST(div, udivrem_512_by_256)
         const auto [quot, rem] = udivrem(t.numerator, d);
         EXPECT_EQ(quot, t.quotient);
         EXPECT_EQ(rem, t.reminder);
+        EXPECT_EQ(udiv(t.numerator, d), t.quotient);
+        EXPECT_EQ(umod(t.numerator, d), t.reminder);
     }
 }
 
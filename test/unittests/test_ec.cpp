@@ -0,0 +1,129 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include <gtest/gtest.h>
+#include <intx/ec.hpp>
+#include <test/utils/random.hpp>
+
+using namespace intx;
+
+namespace
+{
+struct curve_test_case
+{
+    const char* name;
+    const ec::curve& (*get)();
+    ec::affine_point g2;  ///< 2G.
+    uint256 k;
+    ec::affine_point kg;  ///< k * G.
+};
+
+constexpr auto test_scalar =
+    0x8c5e3b1a9f4d2e7a1b3c5d7e9f0a2b4c6d8e0f1a3b5c7d9e1f2a4b6c8d0e2f4a_u256;
+
+const curve_test_case curve_test_cases[] = {
+    {"secp256k1", ec::secp256k1,
+        {0xc6047f9441ed7d6d3045406e95c07cd85c778e4b8cef3ca7abac09b95c709ee5_u256,
+            0x1ae168fea63dc339a3c58419466ceaeef7f632653266d0e1236431a950cfe52a_u256},
+        test_scalar,
+        {0x23927dc363ffcb3c8e1791e670287303a27cfc9e85d3a899aa0affc6f14b0029_u256,
+            0x7bedb919a52fdb0b9a6f1981c71e69408ada35673f73667ff93338e385448338_u256}},
+    {"p256", ec::p256,
+        {0x7cf27b188d034f7e8a52380304b51ac3c08969e277f21b35a60b48fc47669978_u256,
+            0x07775510db8ed040293d9ac69f7430dbba7dade63ce982299e04b79d227873d1_u256},
+        test_scalar,
+        {0xbe07328b80719a68f25a359a0578dc08e9de4db96e4c7094cc0d682c3bcffb30_u256,
+            0xf87ec40ff9deb5fc087205eba2de48f5dbe29c0e348dd14f45975250fd5413c3_u256}},
+    {"bn254", ec::bn254,
+        {0x030644e72e131a029b85045b68181585d97816a916871ca8d3c208c16d87cfd3_u256,
+            0x15ed738c0e0a7c92e7845f96b2ae9c0a68a6a449e3538fc7ff3ebf7a5a18a2c4_u256},
+        test_scalar,
+        {0x1224a3ecf1e15024c23ccae6c868410f4427c58c803781422f2819ef6b76400e_u256,
+            0x18edfe66c1e55ef746562ddca398ae7f102ea8e047d0aded6d8827e48aca9637_u256}},
+};
+}  // namespace
+
+TEST(ec, known_points)
+{
+    for (const auto& t : curve_test_cases)
+    {
+        SCOPED_TRACE(t.name);
+        const auto& c = t.get();
+        const auto& g = c.generator();
+
+        EXPECT_TRUE(c.is_on_curve(g));
+        EXPECT_TRUE(c.is_on_curve(t.g2));
+        EXPECT_TRUE(c.is_on_curve(t.kg));
+        EXPECT_FALSE(c.is_on_curve({}));
+        EXPECT_FALSE(c.is_on_curve({g.x, g.y + 1}));
+
+        EXPECT_EQ(c.to_affine(c.dbl(c.to_jacobian(g))), t.g2);
+        EXPECT_EQ(c.add(g, g), t.g2);
+        EXPECT_EQ(c.mul(g, 2), t.g2);
+        EXPECT_EQ(c.mul_g(2), t.g2);
+
+        EXPECT_EQ(c.mul(g, t.k), t.kg);
+        EXPECT_EQ(c.mul_g(t.k), t.kg);
+    }
+}
+
+TEST(ec, special_scalars)
+{
+    for (const auto& t : curve_test_cases)
+    {
+        SCOPED_TRACE(t.name);
+        const auto& c = t.get();
+        const auto& g = c.generator();
+        const auto& n = c.order();
+        const ec::affine_point neg_g{g.x, c.field().mod() - g.y};
+
+        EXPECT_EQ(c.mul_g(0), ec::affine_point{});
+        EXPECT_EQ(c.mul(g, 0), ec::affine_point{});
+        EXPECT_EQ(c.mul_g(1), g);
+        EXPECT_EQ(c.mul(g, 1), g);
+        EXPECT_EQ(c.mul_g(n), ec::affine_point{});
+        EXPECT_EQ(c.mul(g, n), ec::affine_point{});
+        EXPECT_EQ(c.mul_g(n - 1), neg_g);
+        EXPECT_EQ(c.mul(g, n - 1), neg_g);
+        EXPECT_EQ(c.mul_g(n + 1), g);
+        EXPECT_EQ(c.mul(ec::affine_point{}, t.k), ec::affine_point{});
+
+        EXPECT_EQ(c.add(g, neg_g), ec::affine_point{});
+        EXPECT_EQ(c.add(g, ec::affine_point{}), g);
+        EXPECT_EQ(c.add(ec::affine_point{}, g), g);
+        EXPECT_EQ(c.to_affine(c.negate(c.to_jacobian(g))), neg_g);
+    }
+}
+
+TEST(ec, scalar_mul_consistency)
+{
+    test::lcg<uint256> rng(test::get_seed());
+    for (const auto& t : curve_test_cases)
+    {
+        SCOPED_TRACE(t.name);
+        const auto& c = t.get();
+
+        for (int i = 0; i < 5; ++i)
+        {
+            const auto a = rng();
+            const auto b = rng();
+            const auto q = c.mul_g(a);
+            ASSERT_TRUE(c.is_on_curve(q));
+            EXPECT_EQ(c.mul(c.generator(), a), q);
+
+            // a * (b * G) == b * (a * G) == (a * b mod n) * G.
+            const auto ab = udivrem(umul(a, b), c.order()).rem;
+            const auto abg = c.mul_g(ab);
+            EXPECT_EQ(c.mul(q, b), abg);
+            EXPECT_EQ(c.mul(c.mul_g(b), a), abg);
+
+            // u1 * G + u2 * Q with the mixed and the full additions.
+            const auto expected = c.add(c.mul_g(b), c.mul(q, a));
+            EXPECT_EQ(c.double_mul(b, a, q), expected);
+            EXPECT_EQ(c.to_affine(c.add_mixed(c.mul_g_jacobian(b),
+                          {c.field().to_mont(c.mul(q, a).x), c.field().to_mont(c.mul(q, a).y)})),
+                expected);
+        }
+    }
+}
@@ -0,0 +1,107 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include "test_suite.hpp"
+#include <intx/fused.hpp>
+#include <test/utils/random.hpp>
+
+using namespace intx;
+using fused::lazy;
+
+namespace
+{
+template <typename Int>
+struct fused_test_inputs
+{
+    Int a;
+    Int b;
+    Int c;
+    Int d;
+    Int m;
+};
+
+template <typename Int>
+std::vector<fused_test_inputs<Int>> gen_inputs()
+{
+    test::lcg<Int> rng(test::get_seed());
+    std::vector<fused_test_inputs<Int>> inputs;
+    for (int i = 0; i < 50; ++i)
+    {
+        fused_test_inputs<Int> in{rng(), rng(), rng(), rng(), rng()};
+        in.m >>= in.m[0] % (Int::num_bits - 1);  // Mix of short and long moduli.
+        if (in.m == 0)
+            in.m = 1;
+        inputs.push_back(in);
+    }
+    const auto max = ~Int{0};
+    inputs.push_back({max, max, max, max, max});
+    inputs.push_back({max, max, max, max, max - 1});
+    inputs.push_back({max, max, max, max, 1});
+    inputs.push_back({0, max, max, 0, 3});
+    return inputs;
+}
+}  // namespace
+
+TYPED_TEST(uint_test, fused_mulmod)
+{
+    using Wide = intx::uint<2 * TypeParam::num_bits>;
+    for (const auto& [a, b, c, d, m] : gen_inputs<TypeParam>())
+    {
+        const auto expected = udivrem(umul(a, b), m).rem;
+        const TypeParam r = lazy(a) * b % m;
+        EXPECT_EQ(r, expected);
+        EXPECT_EQ(a * lazy(b) % m, expected);
+        EXPECT_EQ(lazy(a) * lazy(b) % m, expected);
+
+        const auto expected_quot = static_cast<TypeParam>(udivrem(umul(a, b), Wide{m}).quot);
+        EXPECT_EQ(lazy(a) * b / m, expected_quot);
+        EXPECT_EQ(mul_div(a, b, m), expected_quot);
+    }
+}
+
+TYPED_TEST(uint_test, fused_addmod)
+{
+    using Wide = intx::uint<TypeParam::num_bits + 64>;
+    for (const auto& [a, b, c, d, m] : gen_inputs<TypeParam>())
+    {
+        const auto s = Wide{a} + Wide{b};
+        EXPECT_EQ((lazy(a) + b) % m, udivrem(s, m).rem);
+        EXPECT_EQ((a + lazy(b)) % m, udivrem(s, m).rem);
+        EXPECT_EQ((lazy(a) + lazy(b)) / m, static_cast<TypeParam>(udivrem(s, m).quot));
+        EXPECT_EQ(lazy(a) % m, a % m);
+        EXPECT_EQ(lazy(a) / m, a / m);
+    }
+}
+
+TYPED_TEST(uint_test, fused_mac)
+{
+    constexpr auto N = TypeParam::num_bits;
+    for (const auto& [a, b, c, d, m] : gen_inputs<TypeParam>())
+    {
+        const auto mac = intx::uint<2 * N + 64>{umul(a, b)} + intx::uint<2 * N + 64>{c};
+        EXPECT_EQ((lazy(a) * b + c) % m, udivrem(mac, m).rem);
+        EXPECT_EQ((c + lazy(a) * b) % m, udivrem(mac, m).rem);
+        EXPECT_EQ((lazy(a) * b + c) / m, static_cast<TypeParam>(udivrem(mac, m).quot));
+
+        const auto two_products =
+            intx::uint<2 * N + 64>{umul(a, b)} + intx::uint<2 * N + 64>{umul(c, d)};
+        EXPECT_EQ((lazy(a) * b + lazy(c) * d) % m, udivrem(two_products, m).rem);
+
+        // Without reduction the usual truncating semantics are preserved.
+        const TypeParam t = lazy(a) * b + lazy(c) * d;
+        EXPECT_EQ(t, a * b + c * d);
+        const TypeParam u = lazy(a) * b + c;
+        EXPECT_EQ(u, a * b + c);
+    }
+}
+
+TEST(fused, uint256_dispatch)
+{
+    const auto a = 0xb1a2bc2ec50000000000000000000000000000000000000000000000000000ff_u256;
+    const auto b = 0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffe_u256;
+    const auto m = 0xfffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f_u256;
+    EXPECT_EQ(lazy(a) * b % m, mulmod(a, b, m));
+    EXPECT_EQ((lazy(a) + b) % m, addmod(a, b, m));
+    EXPECT_NE(lazy(a) * b % m, a * b % m);  // The plain operators lose the high product bits.
+}
@@ -0,0 +1,90 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include "test_suite.hpp"
+#include <intx/gmp.hpp>
+#include <test/utils/random.hpp>
+
+using namespace intx;
+
+namespace
+{
+template <typename Int>
+std::vector<Int> gen_values()
+{
+    test::lcg<Int> rng(test::get_seed());
+    std::vector<Int> values{0, 1, ~Int{0}, ~Int{0} >> 64, Int{1} << (Int::num_bits - 1)};
+    for (int i = 0; i < 20; ++i)
+    {
+        const auto x = rng();
+        values.push_back(x >> (x[0] % Int::num_bits));
+    }
+    return values;
+}
+
+std::string get_str(mpz_srcptr x)
+{
+    std::string s(mpz_sizeinbase(x, 10) + 2, '\0');
+    mpz_get_str(s.data(), 10, x);
+    s.resize(std::strlen(s.c_str()));
+    return s;
+}
+}  // namespace
+
+TYPED_TEST(uint_test, gmp_view)
+{
+    for (const auto& x : gen_values<TypeParam>())
+    {
+        const mpz_view v{x};
+        EXPECT_EQ(get_str(v.get()), to_string(x));
+        EXPECT_EQ(mpz_sgn(v.get()), x == 0 ? 0 : 1);
+        EXPECT_EQ(mpz_size(v.get()), count_significant_words(x));
+    }
+}
+
+TYPED_TEST(uint_test, gmp_to_from_mpz)
+{
+    constexpr auto N = TypeParam::num_bits;
+
+    mpz_t z;
+    mpz_init(z);
+    for (const auto& x : gen_values<TypeParam>())
+    {
+        to_mpz(z, x);
+        EXPECT_EQ(get_str(z), to_string(x));
+        EXPECT_TRUE(fits<N>(z));
+        EXPECT_EQ(from_mpz<N>(z), x);
+
+        // Negative values are converted to the two's complement form.
+        mpz_neg(z, z);
+        EXPECT_EQ(fits<N>(z), x == 0);
+        EXPECT_EQ(from_mpz<N>(z), -x);
+    }
+
+    // The values not fitting uint<N> are truncated.
+    mpz_set_ui(z, 3);
+    mpz_mul_2exp(z, z, N - 1);
+    EXPECT_FALSE(fits<N>(z));
+    EXPECT_EQ(from_mpz<N>(z), TypeParam{1} << (N - 1));
+    mpz_clear(z);
+}
+
+TYPED_TEST(uint_test, gmp_with_mpz)
+{
+    const auto values = gen_values<TypeParam>();
+
+    mpz_t r;
+    mpz_init(r);
+    for (size_t i = 1; i < values.size(); ++i)
+    {
+        const auto& x = values[i - 1];
+        const auto& y = values[i];
+        with_mpz([&](mpz_srcptr a, mpz_srcptr b) { mpz_mul(r, a, b); }, x, y);
+        EXPECT_EQ(from_mpz<2 * TypeParam::num_bits>(r), umul(x, y));
+
+        const auto c = with_mpz([](mpz_srcptr a, mpz_srcptr b) { return mpz_cmp(a, b); }, x, y);
+        EXPECT_EQ(c < 0, x < y);
+    }
+    mpz_clear(r);
+}
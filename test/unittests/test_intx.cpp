@@ -3,6 +3,7 @@
 // Licensed under the Apache License, Version 2.0.
 
 #include "test_suite.hpp"
+#include <test/utils/random.hpp>
 
 using namespace intx;
 
@@ -152,6 +153,32 @@ TYPED_TEST(uint_test, endianness)
     EXPECT_EQ(be::unsafe::load<TypeParam>(data), x);
 }
 
+TYPED_TEST(uint_test, endianness_words)
+{
+    // The word conversions checked against the generic ones.
+    constexpr auto s = sizeof(TypeParam);
+
+    uint8_t data[s];
+    for (size_t i = 0; i < s; ++i)
+        data[i] = static_cast<uint8_t>(i + 1);
+
+    TypeParam native;
+    std::memcpy(&native, data, s);
+
+    uint8_t out[s];
+    const auto x = internal::load_le_words<TypeParam>(data);
+    EXPECT_EQ(x, to_little_endian(native));
+    internal::store_le_words(out, x);
+    EXPECT_EQ(std::memcmp(out, data, s), 0);
+
+    const auto y = internal::load_be_words<TypeParam>(data);
+    EXPECT_EQ(y, to_big_endian(native));
+    EXPECT_EQ(y >> (s * 8 - 8), 1);
+    EXPECT_EQ(static_cast<uint8_t>(y), s);
+    internal::store_be_words(out, y);
+    EXPECT_EQ(std::memcmp(out, data, s), 0);
+}
+
 TYPED_TEST(uint_test, be_zext)
 {
     uint8_t data[] = {0x01, 0x02, 0x03};
@@ -284,3 +311,209 @@ TYPED_TEST(uint_test, as_bytes)
     y = to_little_endian(y);
     EXPECT_EQ(y, 0xc03);
 }
+
+TYPED_TEST(uint_test, umul_add)
+{
+    using Wide = intx::uint<2 * TypeParam::num_bits>;
+    const auto max = ~TypeParam{0};
+    const TypeParam values[] = {
+        0,
+        1,
+        max,
+        max - 1,
+        TypeParam{1} << (TypeParam::num_bits - 1),
+        (TypeParam{1} << 64) - 1,
+        TypeParam{0x5851f42d4c957f2d} << 60,
+    };
+
+    for (const auto& x : values)
+    {
+        for (const auto& y : values)
+        {
+            for (const auto& z : values)
+            {
+                const auto w = ~z;
+                const auto expected = umul(x, y) + Wide{z};
+                EXPECT_EQ(umul_add(x, y, z), expected);
+                EXPECT_EQ(umul_add(x, y, z, w), expected + Wide{w});
+                EXPECT_EQ(mul_add(x, y, z), x * y + z);
+                EXPECT_EQ(mul_add(x, y, z, w), x * y + z + w);
+            }
+        }
+    }
+
+    // The maximal result fits exactly.
+    EXPECT_EQ(umul_add(max, max, max, max), ~Wide{0});
+}
+
+TYPED_TEST(uint_test, mul_flagless)
+{
+    // The kernels of the architectures without the carry flag, checked against the default ones.
+    const auto max = ~TypeParam{0};
+    std::vector<TypeParam> values = {0, 1, max, max - 1, TypeParam{1} << (TypeParam::num_bits - 1),
+        (TypeParam{1} << 64) - 1};
+    test::lcg<TypeParam> rng(test::get_seed());
+    for (int i = 0; i < 10; ++i)
+        values.push_back(rng());
+
+    constexpr auto num_words = static_cast<int>(TypeParam::num_words);
+    for (const auto& x : values)
+    {
+        for (const auto& y : values)
+        {
+            EXPECT_EQ(internal::umul_flagless(x, y), umul(x, y));
+            EXPECT_EQ(internal::mul_flagless(x, y), x * y);
+
+            TypeParam r1;
+            TypeParam r2;
+            const auto b1 = internal::submul(&r1[0], &x[0], &y[0], num_words, y[0]);
+            const auto b2 = internal::submul_flagless(&r2[0], &x[0], &y[0], num_words, y[0]);
+            EXPECT_EQ(r2, r1);
+            EXPECT_EQ(b2, b1);
+        }
+    }
+}
+
+TYPED_TEST(uint_test, compound_assignment_in_place)
+{
+    constexpr auto num_bits = TypeParam::num_bits;
+    const auto max = ~TypeParam{0};
+    const TypeParam values[] = {
+        0,
+        1,
+        max,
+        TypeParam{1} << (num_bits - 1),
+        TypeParam{0x5851f42d4c957f2d} << 60,
+        max / 3,
+    };
+
+    for (const auto& x : values)
+    {
+        for (const auto& y : values)
+        {
+            auto r = x;
+            EXPECT_EQ(r += y, x + y);
+            r = x;
+            EXPECT_EQ(r -= y, x - y);
+            r = x;
+            EXPECT_EQ(r |= y, x | y);
+            r = x;
+            EXPECT_EQ(r &= y, x & y);
+            r = x;
+            EXPECT_EQ(r ^= y, x ^ y);
+
+            constexpr uint64_t w = 0xfedcba9876543210;
+            const auto expected = umul(y, TypeParam{w}) + intx::uint<2 * num_bits>{x};
+            r = x;
+            EXPECT_EQ(addmul(r, y, w), expected[TypeParam::num_words]);
+            EXPECT_EQ(r, static_cast<TypeParam>(expected));
+        }
+
+        // Aliased operands.
+        auto r = x;
+        EXPECT_EQ(r += r, x + x);
+        r = x;
+        EXPECT_EQ(r -= r, 0);
+        r = x;
+        EXPECT_EQ(r ^= r, 0);
+
+        for (const uint64_t s : {0u, 1u, 63u, 64u, 65u, num_bits - 64, num_bits - 1, num_bits})
+        {
+            r = x;
+            EXPECT_EQ(r <<= s, x << s);
+            r = x;
+            EXPECT_EQ(r >>= s, x >> s);
+            r = x;
+            EXPECT_EQ(r <<= TypeParam{s}, x << s);
+            r = x;
+            EXPECT_EQ(r >>= int(s), x >> s);
+        }
+
+        for (const uint64_t w : {0ull, 1ull, 3ull, ~0ull})
+        {
+            r = x;
+            EXPECT_EQ(r *= w, x * TypeParam{w});
+        }
+    }
+}
+
+TYPED_TEST(uint_test, word_scalar)
+{
+    test::lcg<TypeParam> rng(test::get_seed());
+    const auto max = ~TypeParam{0};
+    std::vector<TypeParam> values{0, 1, max, max >> 64, TypeParam{1} << (TypeParam::num_bits - 1)};
+    for (int i = 0; i < 10; ++i)
+    {
+        const auto x = rng();
+        values.push_back(x >> (x[0] % TypeParam::num_bits));
+    }
+
+    for (const auto& x : values)
+    {
+        const uint64_t words[] = {1, 3, 10, 0x8000000000000000, ~uint64_t{0}, x[0] | 1};
+        for (const auto w : words)
+        {
+            const TypeParam y{w};
+            EXPECT_EQ(add_1(x, w), x + y);
+            EXPECT_EQ(sub_1(x, w), x - y);
+            EXPECT_EQ(mul_1(x, w), x * y);
+            const auto [q, r] = divrem_1(x, w);
+            EXPECT_EQ(q, udivrem(x, y).quot);
+            EXPECT_EQ(r, udivrem(x, y).rem);
+
+            // The algorithms of divrem_1() selected by the tuned threshold.
+            const auto n = count_significant_words(x);
+            const auto res_reciprocal = internal::divrem_1_reciprocal(x, n, w);
+            EXPECT_EQ(res_reciprocal.quot, q);
+            EXPECT_EQ(res_reciprocal.rem, r);
+#if INTX_HAS_HW_DIV_2BY1
+            const auto res_hw = internal::divrem_1_hw(x, n, w);
+            EXPECT_EQ(res_hw.quot, q);
+            EXPECT_EQ(res_hw.rem, r);
+#endif
+
+            EXPECT_EQ(x + w, x + y);
+            EXPECT_EQ(w + x, x + y);
+            EXPECT_EQ(x - w, x - y);
+            EXPECT_EQ(x * w, x * y);
+            EXPECT_EQ(w * x, x * y);
+            EXPECT_EQ(x / w, udivrem(x, y).quot);
+            EXPECT_EQ(x % w, udivrem(x, y).rem);
+        }
+
+        // Signed operands are converted to uint64_t, as by the uint<N> constructor.
+        EXPECT_EQ(x * -1, x * TypeParam{uint64_t(-1)});
+        EXPECT_EQ(x / -1, x / TypeParam{uint64_t(-1)});
+    }
+}
+
+TYPED_TEST(uint_test, mul_const)
+{
+    using Wide = intx::uint<2 * TypeParam::num_bits>;
+    test::lcg<TypeParam> rng(test::get_seed());
+    std::vector<TypeParam> values{0, 1, ~TypeParam{0}};
+    for (int i = 0; i < 10; ++i)
+        values.push_back(rng());
+
+    for (const auto& x : values)
+    {
+        EXPECT_EQ(mul_const<0>(x), 0);
+        EXPECT_EQ(mul_const<1>(x), x);
+        EXPECT_EQ(mul_const<0x5851f42d4c957f2d>(x), x * TypeParam{0x5851f42d4c957f2d});
+        EXPECT_EQ(mul_const<1000000000000000000>(x), x * TypeParam{1000000000000000000});
+        EXPECT_EQ(mul_const<0x8000000000000000>(x), x << 63);
+        EXPECT_EQ((mul_const<0, 1>(x)), x << 64);
+        EXPECT_EQ((mul_const<1, 0, 1>(x)), x + (x << 128));
+        EXPECT_EQ((mul_const<3, 0, 0, 5>(x)), x * ((TypeParam{5} << 192) | 3));
+
+        EXPECT_EQ(umul_const<0>(x), 0);
+        EXPECT_EQ(umul_const<1>(x), Wide{x});
+        EXPECT_EQ(umul_const<~uint64_t{0}>(x), umul(x, TypeParam{~uint64_t{0}}));
+        EXPECT_EQ((umul_const<16, 0x5851f42d4c957f2d>(x)),
+            umul(x, TypeParam{16, 0x5851f42d4c957f2d}));
+        EXPECT_EQ((umul_const<0, 0x8000000000000000>(x)), Wide{x} << 127);
+    }
+
+    static_assert(mul_const<3>(TypeParam{7}) == 21);
+    static_assert(umul_const<0, 2>(~TypeParam{0}) == Wide{~TypeParam{0}} << 65);
+}
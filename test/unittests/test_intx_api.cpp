@@ -21,6 +21,8 @@ static_assert(uint256{2} * uint256{2} == 4);
 static_assert(uint512{2} * uint512{2} == 4);
 
 static_assert(umul(uint256{2}, uint256{3}) == 6);
+static_assert(umul_add(uint256{2}, uint256{3}, uint256{4}) == 10);
+static_assert(mul_add(uint256{2}, uint256{3}, uint256{4}, uint256{5}) == 15);
 
 static_assert(0_u256 == 0);
 static_assert(-1_u256 == ~0_u256);
@@ -0,0 +1,109 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include "test_suite.hpp"
+#include <intx/montgomery.hpp>
+#include <test/utils/random.hpp>
+
+using namespace intx;
+
+namespace
+{
+template <typename Int>
+std::vector<Int> gen_odd_moduli()
+{
+    test::lcg<Int> rng(test::get_seed());
+    const auto max = ~Int{0};
+    std::vector<Int> moduli{1, 3, max, max >> 1, max >> 2, max >> 3, (max >> 64) | 1};
+    for (int i = 0; i < 20; ++i)
+    {
+        auto m = rng();
+        m >>= m[0] % (Int::num_bits - 1);  // Mix of short and long moduli.
+        moduli.push_back(m | 1);
+    }
+    return moduli;
+}
+}  // namespace
+
+TYPED_TEST(uint_test, montgomery_mul)
+{
+    test::lcg<TypeParam> rng(test::get_seed());
+    for (const auto& m : gen_odd_moduli<TypeParam>())
+    {
+        const montgomery<TypeParam::num_bits> ctx{m};
+        EXPECT_EQ(ctx.mod(), m);
+        EXPECT_EQ(ctx.from_mont(ctx.one()), 1 % m);
+
+        for (int i = 0; i < 10; ++i)
+        {
+            const auto x = rng();
+            const auto y = rng();
+            const auto xm = ctx.to_mont(x);
+            const auto ym = ctx.to_mont(y);
+            EXPECT_LT(xm, m);
+            EXPECT_EQ(ctx.from_mont(xm), x % m);
+            EXPECT_EQ(ctx.from_mont(ctx.mul(xm, ym)), udivrem(umul(x, y), m).rem);
+
+            const auto xr = x % m;
+            const auto yr = y % m;
+            using Wide = intx::uint<2 * TypeParam::num_bits>;
+            EXPECT_EQ(ctx.add(xr, yr), udivrem(Wide{xr} + Wide{yr}, m).rem);
+            EXPECT_EQ(ctx.add(ctx.sub(xr, yr), yr), xr);
+
+            if (ctx.has_spare_bits())
+            {
+                const auto p = ctx.almost_mul(xm, ym);
+                EXPECT_LT(p, 2 * m);
+                EXPECT_EQ(ctx.from_mont(p), udivrem(umul(x, y), m).rem);
+            }
+        }
+
+        const auto mm1 = m - 1;
+        EXPECT_EQ(ctx.from_mont(ctx.mul(ctx.to_mont(mm1), ctx.to_mont(mm1))), 1 % m);
+    }
+}
+
+TYPED_TEST(uint_test, montgomery_multi)
+{
+    test::lcg<TypeParam> rng(test::get_seed());
+    for (const auto& m : gen_odd_moduli<TypeParam>())
+    {
+        const montgomery<TypeParam::num_bits> ctx{m};
+
+        TypeParam xs[5];
+        TypeParam ys[5];
+        TypeParam es[5];
+        for (size_t k = 0; k < std::size(xs); ++k)
+        {
+            xs[k] = ctx.to_mont(rng());
+            ys[k] = ctx.to_mont(rng());
+            es[k] = rng() >> (17 * k);
+        }
+        es[4] = 0;
+
+        TypeParam r[5];
+        ctx.mul(r, xs, ys);
+        for (size_t k = 0; k < std::size(xs); ++k)
+            EXPECT_EQ(r[k], ctx.mul(xs[k], ys[k])) << k;
+
+        ctx.pow(r, xs, es);
+        for (size_t k = 0; k < std::size(xs); ++k)
+        {
+            // Check against the binary exponentiation.
+            auto expected = ctx.one();
+            for (auto i = TypeParam::num_bits; i-- != 0;)
+            {
+                expected = ctx.mul(expected, expected);
+                if (((es[k] >> i) & 1) != 0)
+                    expected = ctx.mul(expected, xs[k]);
+            }
+            EXPECT_EQ(r[k], expected) << k;
+            EXPECT_EQ(ctx.pow(xs[k], es[k]), expected) << k;
+        }
+
+        const auto x0 = xs[0];
+        ctx.mul(xs, xs, xs);  // The result aliases the operands.
+        EXPECT_EQ(xs[0], ctx.mul(x0, x0));
+    }
+}
@@ -0,0 +1,93 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include "test_suite.hpp"
+#include <intx/multiversion.hpp>
+#include <test/utils/random.hpp>
+#include <cstring>
+#include <vector>
+
+using namespace intx;
+
+TEST(multiversion, selected_isa)
+{
+    const std::string isa = mv::selected_isa();
+    EXPECT_TRUE(isa == "default" || isa == "x86-64-v2" || isa == "x86-64-v3" ||
+                isa == "x86-64-v4")
+        << isa;
+#if !INTX_HAS_TARGET_CLONES
+    EXPECT_EQ(isa, "default");
+#endif
+}
+
+TYPED_TEST(uint_test, multiversion_arithmetic)
+{
+    test::lcg<TypeParam> rng(test::get_seed());
+    for (int i = 0; i < 100; ++i)
+    {
+        const auto x = rng();
+        // Vary the length of the divisor to cover all the division algorithms.
+        const auto y = rng() >> (static_cast<unsigned>(i) * 7 % TypeParam::num_bits);
+        const auto shift = static_cast<uint64_t>(i) * 13 % (TypeParam::num_bits + 10);
+
+        EXPECT_EQ(mv::umul(x, y), umul(x, y));
+        EXPECT_EQ(mv::mul(x, y), x * y);
+        if (y != 0)
+        {
+            const auto [q, r] = mv::udivrem(x, y);
+            const auto [eq, er] = udivrem(x, y);
+            EXPECT_EQ(q, eq);
+            EXPECT_EQ(r, er);
+        }
+        EXPECT_EQ(mv::shl(x, shift), x << shift);
+        EXPECT_EQ(mv::shr(x, shift), x >> shift);
+        EXPECT_EQ(mv::bit_and(x, y), x & y);
+        EXPECT_EQ(mv::bit_or(x, y), x | y);
+        EXPECT_EQ(mv::bit_xor(x, y), x ^ y);
+    }
+}
+
+TEST(multiversion, bitwise_large)
+{
+    using T = intx::uint<4096>;
+    T x;
+    T y;
+    for (unsigned i = 0; i < T::num_words; ++i)
+    {
+        x[i] = 0x0123456789abcdef * (i + 1);
+        y[i] = ~x[i] ^ i;
+    }
+    EXPECT_EQ(mv::bit_and(x, y), x & y);
+    EXPECT_EQ(mv::bit_or(x, y), x | y);
+    EXPECT_EQ(mv::bit_xor(x, y), x ^ y);
+}
+
+TYPED_TEST(uint_test, multiversion_load_store_n)
+{
+    constexpr size_t n = 5;
+    constexpr auto size = sizeof(TypeParam);
+    test::lcg<TypeParam> rng(test::get_seed());
+    std::vector<TypeParam> values(n);
+    std::generate(values.begin(), values.end(), rng);
+
+    std::vector<uint8_t> be_bytes(n * size);
+    std::vector<uint8_t> le_bytes(n * size);
+    mv::be_store_n(be_bytes.data(), values.data(), n);
+    mv::le_store_n(le_bytes.data(), values.data(), n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        uint8_t expected[size];
+        be::unsafe::store(expected, values[i]);
+        EXPECT_EQ(std::memcmp(&be_bytes[i * size], expected, size), 0);
+        le::unsafe::store(expected, values[i]);
+        EXPECT_EQ(std::memcmp(&le_bytes[i * size], expected, size), 0);
+    }
+
+    std::vector<TypeParam> loaded(n);
+    mv::be_load_n(loaded.data(), be_bytes.data(), n);
+    EXPECT_EQ(loaded, values);
+    loaded.assign(n, 0);
+    mv::le_load_n(loaded.data(), le_bytes.data(), n);
+    EXPECT_EQ(loaded, values);
+}
@@ -0,0 +1,104 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include <gtest/gtest.h>
+#include <intx/packed.hpp>
+#include <test/utils/random.hpp>
+#include <algorithm>
+#include <unordered_set>
+
+using namespace intx;
+
+using address = uint_packed<20>;
+
+static_assert(sizeof(address) == 20);
+static_assert(alignof(address) == 1);
+static_assert(address::widened_bits == 192);
+static_assert(uint_packed<31>::widened_bits == 256);
+static_assert(uint_packed<3>::widened_bits == 128);
+static_assert(std::is_convertible_v<address, uint192>);
+static_assert(std::is_convertible_v<address, uint256>);
+static_assert(!std::is_convertible_v<address, uint128>);
+static_assert(!std::is_convertible_v<uint256, address>);
+
+TEST(packed, widen)
+{
+    const auto x = 0x0102030405060708090a0b0c0d0e0f1011121314_u256;
+    const address a{x};
+    EXPECT_EQ(a.bytes[0], 0x01);
+    EXPECT_EQ(a.bytes[19], 0x14);
+    EXPECT_EQ(a.widen(), x);
+    EXPECT_EQ(uint256{a}, x);
+    EXPECT_EQ(uint512{a}, x);
+
+    // Truncation of the higher bytes.
+    const address b{(0xff_u256 << 160) | x};
+    EXPECT_EQ(b, a);
+
+    // Zero-extension of the smaller value.
+    const uint_packed<24> c{uint128{0x0102, 0x0304}};
+    EXPECT_EQ(c.widen(), (uint192{0x0304} << 64) | 0x0102);
+    EXPECT_EQ(c.bytes[0], 0);
+}
+
+TEST(packed, be_load_store)
+{
+    const auto x = 0xc0ffeec0ffeec0ffeec0ffeec0ffeec0ffeec0ff_u256;
+    const auto a = be::trunc<address>(x);
+    EXPECT_EQ(a, address{x});
+    EXPECT_EQ(be::load<uint256>(a), x);
+
+    const auto p = be::store<uint_packed<32>>(x);
+    EXPECT_EQ(p.widen(), x);
+    EXPECT_EQ(be::load<uint256>(p), x);
+}
+
+TEST(packed, compare)
+{
+    test::lcg<uint256> rng(test::get_seed());
+    std::vector<uint256> values{0, 1, (uint256{1} << 160) - 1, uint256{1} << 159, 0xff};
+    for (int i = 0; i < 50; ++i)
+        values.push_back(rng() >> 96);
+    values.push_back(values.back() + 1);
+    values.push_back(values.back() ^ (uint256{1} << 100));
+
+    for (const auto& x : values)
+    {
+        for (const auto& y : values)
+        {
+            const address a{x};
+            const address b{y};
+            EXPECT_EQ(a == b, x == y);
+            EXPECT_EQ(a != b, x != y);
+            EXPECT_EQ(a < b, x < y);
+            EXPECT_EQ(a > b, x > y);
+            EXPECT_EQ(a <= b, x <= y);
+            EXPECT_EQ(a >= b, x >= y);
+        }
+    }
+}
+
+TEST(packed, sort_and_hash)
+{
+    test::lcg<uint256> rng(test::get_seed());
+    std::vector<address> v;
+    std::vector<uint256> expected;
+    for (int i = 0; i < 100; ++i)
+    {
+        const auto x = rng() >> 96;
+        v.emplace_back(x);
+        expected.push_back(x);
+    }
+    std::sort(v.begin(), v.end());
+    std::sort(expected.begin(), expected.end());
+    for (size_t i = 0; i < v.size(); ++i)
+        EXPECT_EQ(v[i].widen(), expected[i]);
+
+    const std::unordered_set<address> set(v.begin(), v.end());
+    EXPECT_EQ(set.size(), v.size());
+    for (const auto& a : v)
+        EXPECT_EQ(set.count(a), 1);
+    EXPECT_EQ(set.count(address{}), 0);
+    EXPECT_NE(std::hash<address>{}(v[0]), std::hash<address>{}(v[1]));
+}
@@ -0,0 +1,81 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include "test_suite.hpp"
+#include <intx/poly.hpp>
+#include <test/utils/random.hpp>
+
+using namespace intx;
+
+namespace
+{
+/// Sums the terms c[i] * x^i mod m with the powers of x computed separately.
+template <typename Int>
+Int poly_eval_naive(const std::vector<Int>& coeffs, const Int& x, const Int& mod)
+{
+    using Wide = intx::uint<2 * Int::num_bits>;
+    const auto xr = x % mod;
+    Int r = 0;
+    Int p = 1 % mod;
+    for (const auto& c : coeffs)
+    {
+        r = udivrem(umul(c % mod, p) + Wide{r}, mod).rem;
+        p = udivrem(umul(p, xr), mod).rem;
+    }
+    return r;
+}
+
+template <typename Int>
+std::vector<Int> gen_moduli()
+{
+    const auto max = ~Int{0};
+    return {1, 2, 3, max, max - 1, max >> 1, max >> 2, (max >> 2) - 1, max >> 3, Int{1} << 64,
+        (Int{1} << 64) + 1};
+}
+}  // namespace
+
+TYPED_TEST(uint_test, poly_eval)
+{
+    test::lcg<TypeParam> rng(test::get_seed());
+    const auto max = ~TypeParam{0};
+
+    for (const auto& m : gen_moduli<TypeParam>())
+    {
+        for (const size_t num_coeffs : {0u, 1u, 2u, 17u})
+        {
+            std::vector<TypeParam> coeffs(num_coeffs);
+            std::generate(coeffs.begin(), coeffs.end(), rng);
+            if (num_coeffs > 1)
+                coeffs[1] = max;  // Unreduced coefficient.
+
+            for (const auto& x : {TypeParam{0}, TypeParam{1}, m - 1, max, rng()})
+            {
+                EXPECT_EQ(poly_eval(coeffs.data(), coeffs.size(), x, m),
+                    poly_eval_naive(coeffs, x, m));
+            }
+        }
+    }
+}
+
+TYPED_TEST(uint_test, poly_eval_multi)
+{
+    test::lcg<TypeParam> rng(test::get_seed());
+
+    std::vector<TypeParam> coeffs(33);
+    std::generate(coeffs.begin(), coeffs.end(), rng);
+    std::vector<TypeParam> xs(23);
+    std::generate(xs.begin(), xs.end(), rng);
+
+    for (const auto& m : gen_moduli<TypeParam>())
+    {
+        for (const unsigned num_threads : {1u, 2u, 3u, 8u})
+        {
+            std::vector<TypeParam> results(xs.size());
+            poly_eval_multi(
+                coeffs.data(), coeffs.size(), xs.data(), results.data(), xs.size(), m, num_threads);
+            for (size_t i = 0; i < xs.size(); ++i)
+                EXPECT_EQ(results[i], poly_eval_naive(coeffs, xs[i], m)) << i;
+        }
+    }
+}
@@ -0,0 +1,114 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+#include <gtest/gtest.h>
+#include <intx/sized.hpp>
+#include <test/utils/random.hpp>
+
+using namespace intx;
+
+namespace
+{
+/// Generates the values of all lengths with the majority of them less than 2^64.
+template <unsigned N>
+std::vector<intx::uint<N>> gen_skewed_values()
+{
+    test::lcg<intx::uint<N>> rng(test::get_seed());
+    std::vector<intx::uint<N>> values{0, 1, 2, ~uint64_t{0}, intx::uint<N>{0, 1}, ~intx::uint<N>{}};
+    for (unsigned i = 0; i < 60; ++i)
+    {
+        const auto x = rng();
+        values.push_back(x >> (i % 4 == 0 ? (i * 7) % N : N - 64 + i % 64));
+    }
+    return values;
+}
+
+template <unsigned N>
+void check_sized_arithmetic()
+{
+    const auto values = gen_skewed_values<N>();
+    for (const auto& x : values)
+    {
+        const uint_sized<N> a{x};
+        EXPECT_EQ(a.num_significant_words(), count_significant_words(x));
+        EXPECT_EQ(static_cast<intx::uint<N>>(a), x);
+
+        for (const auto& y : values)
+        {
+            const uint_sized<N> b{y};
+
+            const auto s = a + b;
+            EXPECT_EQ(s.value(), x + y);
+            EXPECT_EQ(s.num_significant_words(), count_significant_words(x + y));
+
+            const auto d = a - b;
+            EXPECT_EQ(d.value(), x - y);
+            EXPECT_EQ(d.num_significant_words(), count_significant_words(x - y));
+
+            const auto p = a * b;
+            EXPECT_EQ(p.value(), x * y);
+            EXPECT_EQ(p.num_significant_words(), count_significant_words(x * y));
+
+            EXPECT_EQ(a == b, x == y);
+            EXPECT_EQ(a != b, x != y);
+            EXPECT_EQ(a < b, x < y);
+            EXPECT_EQ(a > b, x > y);
+            EXPECT_EQ(a <= b, x <= y);
+            EXPECT_EQ(a >= b, x >= y);
+
+            if (y == 0)
+                continue;
+
+            const auto res = udivrem(a, b);
+            const auto expected = udivrem(x, y);
+            EXPECT_EQ(res.quot.value(), expected.quot);
+            EXPECT_EQ(res.rem.value(), expected.rem);
+            EXPECT_EQ(res.quot.num_significant_words(), count_significant_words(expected.quot));
+            EXPECT_EQ(res.rem.num_significant_words(), count_significant_words(expected.rem));
+            EXPECT_EQ((a / b).value(), x / y);
+            EXPECT_EQ((a % b).value(), x % y);
+        }
+    }
+}
+}  // namespace
+
+static_assert(uint_sized<256>{}.num_significant_words() == 0);
+static_assert(uint_sized<256>{5}.num_significant_words() == 1);
+static_assert(uint_sized<256>{uint256{0, 0, 1}}.num_significant_words() == 3);
+static_assert((uint_sized<256>{uint256{0, 1}} * uint_sized<256>{uint256{0, 1}}).value() ==
+              uint256{0, 0, 1});
+
+TEST(sized, arithmetic_128)
+{
+    check_sized_arithmetic<128>();
+}
+
+TEST(sized, arithmetic_256)
+{
+    check_sized_arithmetic<256>();
+}
+
+TEST(sized, arithmetic_512)
+{
+    check_sized_arithmetic<512>();
+}
+
+TEST(sized, compound_assignment)
+{
+    uint_sized<256> x{3};
+    x *= uint_sized<256>{~uint256{} >> 64};
+    EXPECT_EQ(x.value(), 3 * (~uint256{} >> 64));
+    EXPECT_EQ(x.num_significant_words(), 4);
+    x += uint_sized<256>{uint256{1} << 255};
+    EXPECT_EQ(x.num_significant_words(), 4);
+    x /= uint_sized<256>{uint256{1} << 64};
+    EXPECT_EQ(x.value(), ((3 * (~uint256{} >> 64)) + (uint256{1} << 255)) >> 64);
+    x %= uint_sized<256>{1000};
+    EXPECT_EQ(x.num_significant_words(), 1);
+    x -= uint_sized<256>{1000};
+    EXPECT_EQ(x.num_significant_words(), 4);
+    x -= x;
+    EXPECT_EQ(x.num_significant_words(), 0);
+    EXPECT_EQ(x, uint_sized<256>{});
+}
@@ -216,3 +216,25 @@ TEST(uint256, mulmod)
     const auto b = 0x8c9f09b6227ba6542a97343c679e1d11d8bfa29228c18615c2_u256;
     EXPECT_EQ(mulmod(a, b, mod), 0xca283039a2ad0dbd3d60fbadb29e9c7a_u128);
 }
+
+TEST(uint256, mulmod_multi)
+{
+    const auto max = ~uint256{0};
+    const uint256 x[]{0xab0f4afc4c78548d4c30e1ab3449e3_u128,
+        0x4028c97ce32bf74a3a3137956b07a5a699ca8422bdf672f547_u256, max, max, 0};
+    const uint256 y[]{0xf0a4485af15508e448cdddb0d1301664_u128,
+        0x8c9f09b6227ba6542a97343c679e1d11d8bfa29228c18615c2_u256, max, max - 1, max};
+    const uint256 mod[]{0xf0f9d0006f7b450e8f73f621a6ca3b56_u128,
+        0xf0f9d0006f7b450e8f73f621a6ca3b56_u128, max, 3, 1};
+
+    uint256 r[std::size(x)];
+    mulmod(r, x, y, mod);
+    for (size_t k = 0; k < std::size(x); ++k)
+        EXPECT_EQ(r[k], mulmod(x[k], y[k], mod[k])) << k;
+
+    // The result may alias the operands.
+    uint256 xs[2]{x[1], x[2]};
+    mulmod(xs, xs, {y[1], y[2]}, {mod[1], mod[2]});
+    EXPECT_EQ(xs[0], r[1]);
+    EXPECT_EQ(xs[1], r[2]);
+}
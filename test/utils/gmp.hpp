@@ -7,8 +7,7 @@
 
 #pragma once
 
-#include <gmp.h>
-#include <intx/intx.hpp>
+#include <intx/gmp.hpp>
 
 namespace intx::gmp
 {
@@ -64,12 +63,14 @@ inline div_result<Int> sdivrem(const Int& x, const Int& y) noexcept
     auto y_abs = y_is_neg ? -y : y;
 
     mpz_t x_gmp;
-    mpz_init_set_str(x_gmp, to_string(x_abs).c_str(), 10);
+    mpz_init(x_gmp);
+    to_mpz(x_gmp, x_abs);
     if (x_is_neg)
         mpz_neg(x_gmp, x_gmp);
 
     mpz_t y_gmp;
-    mpz_init_set_str(y_gmp, to_string(y_abs).c_str(), 10);
+    mpz_init(y_gmp);
+    to_mpz(y_gmp, y_abs);
     if (y_is_neg)
         mpz_neg(y_gmp, y_gmp);
 
@@ -80,19 +81,8 @@ inline div_result<Int> sdivrem(const Int& x, const Int& y) noexcept
 
     mpz_tdiv_qr(q_gmp, r_gmp, x_gmp, y_gmp);
 
-    char buf[2000];
-
-    mpz_get_str(buf, 10, q_gmp);
-    auto q_is_neg = buf[0] == '-';
-    auto q = from_string<Int>(&buf[q_is_neg]);
-    if (q_is_neg)
-        q = -q;
-
-    mpz_get_str(buf, 10, r_gmp);
-    auto r_is_neg = buf[0] == '-';
-    auto r = from_string<Int>(&buf[r_is_neg]);
-    if (r_is_neg)
-        r = -r;
+    const auto q = from_mpz<Int::num_bits>(q_gmp);
+    const auto r = from_mpz<Int::num_bits>(r_gmp);
 
     mpz_clears(x_gmp, y_gmp, q_gmp, r_gmp, NULL);  // NOLINT(cppcoreguidelines-pro-type-vararg)
 
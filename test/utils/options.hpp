@@ -0,0 +1,44 @@
+// intx: extended precision integer library.
+// Copyright 2022 Pawel Bylica.
+// Licensed under the Apache License, Version 2.0.
+
+/// @file
+/// Helpers for the command-line options of the benchmark tools
+/// passed together with the Google Benchmark ones.
+
+#pragma once
+
+#include <algorithm>
+#include <string>
+
+namespace intx::test
+{
+/// Removes the option --name=<value> from the arguments and returns its value.
+inline std::string take_option(int& argc, char** argv, const std::string& name)
+{
+    const auto prefix = "--" + name + "=";
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+        if (arg.compare(0, prefix.size(), prefix) == 0)
+        {
+            std::copy(&argv[i + 1], &argv[argc], &argv[i]);
+            --argc;
+            return arg.substr(prefix.size());
+        }
+    }
+    return {};
+}
+
+/// Checks if the option of the given name is in the arguments.
+inline bool has_option(int argc, char** argv, const std::string& name)
+{
+    const auto prefix = "--" + name;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::string{argv[i]}.compare(0, prefix.size(), prefix) == 0)
+            return true;
+    }
+    return false;
+}
+}  // namespace intx::test